@@ -0,0 +1,334 @@
+// @file         - ConcurrentArray.hpp
+// @brief        - Declaring an append only array that many threads can push
+//                 to and read from without locks
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - elements never move, so references stay valid. Writing to
+//                 an element while others read it is still a data race.
+// =============================================================================
+
+#ifndef CONCURRENTARRAY_H
+#define CONCURRENTARRAY_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*
+Declare class
+*/
+
+// Segment s holds 2^(FirstBits + s) elements, so each new segment doubles
+// capacity. Segments are allocated on demand and published with a CAS into
+// a fixed directory, which never moves.
+template <typename T, std::size_t FirstBits = 6, typename Alloc = std::allocator<T>>
+class ConcurrentArray {
+    static_assert(FirstBits < 32, "ConcurrentArray requires under 32 first segment bits");
+    // a push that throws after claiming its index would stall publishing,
+    // so allocation happens before the claim and the move mustn't throw
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "ConcurrentArray requires nothrow move constructible elements");
+
+    private:
+        using AllocTraits = std::allocator_traits<Alloc>;
+        using FlagAlloc = typename AllocTraits::template rebind_alloc<std::atomic<bool>>;
+        using FlagTraits = std::allocator_traits<FlagAlloc>;
+
+        static constexpr std::size_t FIRST = std::size_t{1} << FirstBits;
+        static constexpr std::size_t MAX_SEGMENTS = 64 - FirstBits;
+
+        Alloc alloc_{};
+        FlagAlloc flag_alloc_{};
+
+        // elements and matching ready flags of each segment, nullptr until used
+        std::atomic<T*> segments_[MAX_SEGMENTS]{};
+        std::atomic<std::atomic<bool>*> ready_[MAX_SEGMENTS]{};
+
+        // indices handed out to pushes, and prefix of them fully constructed
+        std::atomic<std::size_t> claimed_{0};
+        std::atomic<std::size_t> published_{0};
+
+        // @brief           - finds segment holding some index
+        // @param idx       - element index
+        // @return          - segment number
+        static std::size_t segment_of(std::size_t idx);
+
+        // @brief           - finds number of elements before some segment
+        // @param seg       - segment number
+        static std::size_t segment_start(std::size_t seg);
+
+        // @brief           - returns segment, allocating it if no thread has yet
+        // @param seg       - segment number
+        // @return          - pointer to segment's first slot
+        T* ensure_segment(std::size_t seg);
+
+        // @brief           - pointer to slot of some element, live or not
+        // @param idx       - element index, within an allocated segment
+        T* slot(std::size_t idx);
+
+        // @brief           - true once element at idx is fully constructed
+        // @param idx       - element index
+        bool is_ready(std::size_t idx);
+
+        // @brief           - advances published prefix past any ready elements.
+        //                    Any thread may advance it, so no push waits on another.
+        void publish();
+
+        // @brief           - frees all segments and flags. Elements must be
+        //                    destroyed first.
+        void free_segments();
+
+    public:
+        // @brief           - creates empty array with room for cap elements
+        // @param cap       - number of elements to reserve up front
+        // @param alloc     - allocator that provides all element memory
+        ConcurrentArray(std::size_t cap = FIRST, const Alloc& alloc = Alloc{});
+
+        // segments are shared by all threads, so the array has one owner
+        ConcurrentArray(const ConcurrentArray<T,FirstBits,Alloc>& other) = delete;
+        ConcurrentArray<T,FirstBits,Alloc>& operator=(const ConcurrentArray<T,FirstBits,Alloc>& other) = delete;
+
+        // @brief           - destroys elements and frees segments. No pushes
+        //                    may still be running.
+        ~ConcurrentArray();
+
+        // @brief           - returns number of published elements. Every
+        //                    index below it is safe to read.
+        std::size_t length();
+
+        // @brief           - returns number of reserved memory blocks
+        std::size_t capacity();
+
+        // @brief           - indexes some published element
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& at(std::size_t idx);
+
+        // @brief           - indexes some published element, no bounds check
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& operator[](std::size_t idx);
+
+        // @brief           - adds element to end of array. Safe to call from
+        //                    many threads at once.
+        // @param val       - value of element
+        // @return          - index of added element
+        std::size_t push(T val);
+
+        // @brief           - allocates segments until num elements fit
+        // @param num       - number of slots to reserve
+        void reserve(std::size_t num);
+};
+
+
+/*
+Define class - in hpp file due to template issues
+*/
+
+// @brief           - finds segment holding some index
+// @param idx       - element index
+// @return          - segment number
+template <typename T, std::size_t FirstBits, typename Alloc>
+std::size_t ConcurrentArray<T,FirstBits,Alloc>::segment_of(std::size_t idx) {
+    // segment s covers [FIRST * (2^s - 1), FIRST * (2^(s+1) - 1))
+    return (63 - __builtin_clzll(idx + FIRST)) - FirstBits;
+}
+
+// @brief           - finds number of elements before some segment
+// @param seg       - segment number
+template <typename T, std::size_t FirstBits, typename Alloc>
+std::size_t ConcurrentArray<T,FirstBits,Alloc>::segment_start(std::size_t seg) {
+    return (FIRST << seg) - FIRST;
+}
+
+// @brief           - returns segment, allocating it if no thread has yet
+// @param seg       - segment number
+// @return          - pointer to segment's first slot
+template <typename T, std::size_t FirstBits, typename Alloc>
+T* ConcurrentArray<T,FirstBits,Alloc>::ensure_segment(std::size_t seg) {
+    T* p_seg = this->segments_[seg].load(std::memory_order_acquire);
+    if (p_seg) return p_seg;
+
+    // flags are published first, so a visible segment always has them
+    std::size_t num = FIRST << seg;
+    if (!this->ready_[seg].load(std::memory_order_acquire)) {
+        std::atomic<bool>* p_flags = FlagTraits::allocate(this->flag_alloc_, num);
+        for (std::size_t i = 0; i < num; ++i) {
+            FlagTraits::construct(this->flag_alloc_, p_flags + i, false);
+        }
+
+        std::atomic<bool>* p_expected = nullptr;
+        if (!this->ready_[seg].compare_exchange_strong(p_expected, p_flags)) {
+            // another thread won the race, use its flags
+            FlagTraits::deallocate(this->flag_alloc_, p_flags, num);
+        }
+    }
+
+    p_seg = AllocTraits::allocate(this->alloc_, num);
+    T* p_expected = nullptr;
+    if (!this->segments_[seg].compare_exchange_strong(p_expected, p_seg)) {
+        // another thread won the race, use its segment
+        AllocTraits::deallocate(this->alloc_, p_seg, num);
+        return p_expected;
+    }
+    return p_seg;
+}
+
+// @brief           - pointer to slot of some element, live or not
+// @param idx       - element index, within an allocated segment
+template <typename T, std::size_t FirstBits, typename Alloc>
+T* ConcurrentArray<T,FirstBits,Alloc>::slot(std::size_t idx) {
+    std::size_t seg = segment_of(idx);
+    return this->segments_[seg].load(std::memory_order_acquire) + (idx - segment_start(seg));
+}
+
+// @brief           - true once element at idx is fully constructed
+// @param idx       - element index
+template <typename T, std::size_t FirstBits, typename Alloc>
+bool ConcurrentArray<T,FirstBits,Alloc>::is_ready(std::size_t idx) {
+    std::size_t seg = segment_of(idx);
+    std::atomic<bool>* p_flags = this->ready_[seg].load(std::memory_order_acquire);
+    return p_flags && p_flags[idx - segment_start(seg)].load();
+}
+
+// @brief           - advances published prefix past any ready elements.
+//                    Any thread may advance it, so no push waits on another.
+template <typename T, std::size_t FirstBits, typename Alloc>
+void ConcurrentArray<T,FirstBits,Alloc>::publish() {
+    // ready flags and this loop are sequentially consistent, so of two pushes
+    // finishing out of order, at least one sees the other's flag
+    std::size_t pub = this->published_.load();
+    while (pub < this->claimed_.load() && this->is_ready(pub)) {
+        // on failure pub is reloaded and the loop rechecks it
+        if (this->published_.compare_exchange_weak(pub, pub + 1)) {
+            ++pub;
+        }
+    }
+}
+
+// @brief           - frees all segments and flags. Elements must be
+//                    destroyed first.
+template <typename T, std::size_t FirstBits, typename Alloc>
+void ConcurrentArray<T,FirstBits,Alloc>::free_segments() {
+    for (std::size_t seg = 0; seg < MAX_SEGMENTS; ++seg) {
+        if (T* p_seg = this->segments_[seg].exchange(nullptr)) {
+            AllocTraits::deallocate(this->alloc_, p_seg, FIRST << seg);
+        }
+        if (std::atomic<bool>* p_flags = this->ready_[seg].exchange(nullptr)) {
+            FlagTraits::deallocate(this->flag_alloc_, p_flags, FIRST << seg);
+        }
+    }
+}
+
+// @brief           - creates empty array with room for cap elements
+// @param cap       - number of elements to reserve up front
+// @param alloc     - allocator that provides all element memory
+template <typename T, std::size_t FirstBits, typename Alloc>
+ConcurrentArray<T,FirstBits,Alloc>::ConcurrentArray(std::size_t cap, const Alloc& alloc)
+    : alloc_(alloc), flag_alloc_(alloc) {
+    try {
+        this->reserve(cap);
+    } catch (...) {
+        // destructor won't run for a partially built array
+        this->free_segments();
+        throw;
+    }
+}
+
+// @brief           - destroys elements and frees segments. No pushes
+//                    may still be running.
+template <typename T, std::size_t FirstBits, typename Alloc>
+ConcurrentArray<T,FirstBits,Alloc>::~ConcurrentArray() {
+    std::size_t num = this->published_.load();
+    for (std::size_t i = 0; i < num; ++i) {
+        AllocTraits::destroy(this->alloc_, this->slot(i));
+    }
+
+    this->free_segments();
+}
+
+// @brief           - returns number of published elements. Every
+//                    index below it is safe to read.
+template <typename T, std::size_t FirstBits, typename Alloc>
+std::size_t ConcurrentArray<T,FirstBits,Alloc>::length() {
+    return this->published_.load(std::memory_order_acquire);
+}
+
+// @brief           - returns number of reserved memory blocks
+template <typename T, std::size_t FirstBits, typename Alloc>
+std::size_t ConcurrentArray<T,FirstBits,Alloc>::capacity() {
+    // segments are allocated in order, except while racing pushes fill gaps
+    std::size_t seg = 0;
+    while (seg < MAX_SEGMENTS && this->segments_[seg].load(std::memory_order_acquire)) {
+        ++seg;
+    }
+    return segment_start(seg);
+}
+
+// @brief           - indexes some published element
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, std::size_t FirstBits, typename Alloc>
+T& ConcurrentArray<T,FirstBits,Alloc>::at(std::size_t idx) {
+    if (idx >= this->length()) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    return *this->slot(idx);
+}
+
+// @brief           - indexes some published element, no bounds check
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, std::size_t FirstBits, typename Alloc>
+T& ConcurrentArray<T,FirstBits,Alloc>::operator[](std::size_t idx) {
+    return *this->slot(idx);
+}
+
+// @brief           - adds element to end of array. Safe to call from
+//                    many threads at once.
+// @param val       - value of element
+// @return          - index of added element
+template <typename T, std::size_t FirstBits, typename Alloc>
+std::size_t ConcurrentArray<T,FirstBits,Alloc>::push(T val) {
+    // the slot's segment is allocated before its index is claimed, so a
+    // bad_alloc or full array throws without leaving a claimed index that
+    // never becomes ready and stalls publishing
+    std::size_t idx = this->claimed_.load(std::memory_order_relaxed);
+    std::size_t seg{};
+    T* p_seg = nullptr;
+    do {
+        seg = segment_of(idx);
+        if (seg >= MAX_SEGMENTS) {
+            throw std::length_error("ConcurrentArray is full");
+        }
+        p_seg = this->ensure_segment(seg);
+        // on failure idx is reloaded, possibly into a later segment
+    } while (!this->claimed_.compare_exchange_weak(idx, idx + 1, std::memory_order_relaxed));
+
+    std::size_t offset = idx - segment_start(seg);
+    AllocTraits::construct(this->alloc_, p_seg + offset, std::move(val));
+
+    this->ready_[seg].load(std::memory_order_acquire)[offset].store(true);
+    this->publish();
+    return idx;
+}
+
+// @brief           - allocates segments until num elements fit
+// @param num       - number of slots to reserve
+template <typename T, std::size_t FirstBits, typename Alloc>
+void ConcurrentArray<T,FirstBits,Alloc>::reserve(std::size_t num) {
+    if (num == 0) return;
+
+    std::size_t last = segment_of(num - 1);
+    for (std::size_t seg = 0; seg <= last && seg < MAX_SEGMENTS; ++seg) {
+        this->ensure_segment(seg);
+    }
+}
+
+#endif
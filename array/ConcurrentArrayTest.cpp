@@ -0,0 +1,128 @@
+// @file         - ConcurrentArrayTest.cpp
+// @brief        - Testing a lock free append only array with many threads
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// =============================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "./ConcurrentArray.hpp"
+
+// allocator whose allocations fail while failing is set
+template <typename T>
+struct FailingAlloc {
+    using value_type = T;
+    static inline bool failing = false;
+
+    FailingAlloc() = default;
+    template <typename U>
+    FailingAlloc(const FailingAlloc<U>&) {}
+
+    T* allocate(std::size_t num) {
+        if (failing) throw std::bad_alloc();
+        return std::allocator<T>{}.allocate(num);
+    }
+    void deallocate(T* p, std::size_t num) {
+        std::allocator<T>{}.deallocate(p, num);
+    }
+    template <typename U>
+    bool operator==(const FailingAlloc<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const FailingAlloc<U>&) const { return false; }
+};
+
+int main() {
+    ConcurrentArray<int, 2> a_test;
+
+    // Getter methods
+    std::cout << "Initialised elements: " + std::to_string(a_test.length()) << std::endl;
+    std::cout << "Reserved blocks: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // single thread, indices handed out in order
+    for (int i = 0; i < 10; ++i) {
+        a_test.push(i);
+    }
+    std::cout << "Size after pushes: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+    std::cout << "Element 9: " + std::to_string(a_test.at(9)) << std::endl;
+
+    // out of range index
+    try {
+        a_test.at(10);
+    } catch (const std::range_error& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    // many writers, one reader checking every published element
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 20000;
+    ConcurrentArray<long long, 2> c_test;
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::thread reader([&]() {
+        std::size_t seen = 0;
+        while (!done.load()) {
+            std::size_t len = c_test.length();
+            for (; seen < len; ++seen) {
+                // every value is thread * PER_THREAD + i, never a torn or unset slot
+                long long val = c_test.at(seen);
+                if (val < 0 || val >= THREADS * PER_THREAD) consistent = false;
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t) {
+        writers.emplace_back([&c_test, t]() {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                c_test.push((long long)t * PER_THREAD + i);
+            }
+        });
+    }
+    for (std::thread& w : writers) w.join();
+    done = true;
+    reader.join();
+
+    // every value pushed exactly once
+    std::vector<int> hits(THREADS * PER_THREAD, 0);
+    for (std::size_t i = 0; i < c_test.length(); ++i) {
+        ++hits[c_test.at(i)];
+    }
+    bool once = true;
+    for (int hit : hits) once = once && hit == 1;
+
+    std::cout << "Concurrent pushes: " << c_test.length() << std::endl;
+    std::cout << "Reader saw consistent view: " << consistent.load();
+    std::cout << ", each value once: " << once << std::endl;
+
+    // a push that can't allocate its segment leaves no gap behind
+    ConcurrentArray<int, 2, FailingAlloc<int>> f_test(4);
+    for (int i = 0; i < 4; ++i) f_test.push(i);
+    FailingAlloc<int>::failing = true;
+    try {
+        f_test.push(4);
+    } catch (const std::bad_alloc& e) {
+        std::cout << "Caught bad_alloc, size: " << f_test.length() << std::endl;
+    }
+    FailingAlloc<int>::failing = false;
+    f_test.push(4);
+    f_test.push(5);
+    std::cout << "After failed push: " << f_test.length() << ", element 5: " << f_test.at(5) << std::endl;
+
+    // non trivial elements are destroyed with the array
+    ConcurrentArray<std::string> s_test(1);
+    s_test.push("a");
+    s_test.push(std::string(100, 'b'));
+    std::cout << "String lengths: " << s_test.at(0).length() << " " << s_test.at(1).length() << std::endl;
+
+    return 0;
+}
@@ -2,7 +2,16 @@
 // @brief        - Declaring a dynamic array class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-18
-// @version      - 1.1.2
+// @version      - 2.6.0
+// @since 2.5.0  - Move constructor/assignment and emplace_back
+// @since 2.4.0  - Vectorised find()
+// @since 2.3.0  - Contiguous iterators, data(), unchecked [] and std::span view
+// @since 2.2.0  - Growth policy, reserve and shrink_to_fit. Resizes call the
+//                 policy's on_resize hook instead of logging to std::cout.
+// @since 2.1.0  - Bulk range operations with memmove for trivially copyable T
+// @since 2.0.0  - Allocator template parameter, e.g. for std::pmr arenas
+// @since 1.1.2  - Uninitialised storage. Only live elements are constructed,
+//                 growth moves elements. Index/set limited to live elements.
 // @since 1.1.1  - Allowed index/set to uninitialised, but reserved, memory.
 // @since 1.1.0  - Updated error types from out of range indices
 // @since 1.0.0  - Added new insert function to support derived binary trees
@@ -12,40 +21,135 @@
 #ifndef DYNAMICARRAY_H
 #define DYNAMICARRAY_H
 
+#include <algorithm>
 #include <cstddef>
-#include <iostream>
-
-/* 
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "./GrowthPolicy.hpp"
+#include "./SimdKernels.hpp"
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+/*
 Declare class
 */
 
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
 class DynamicArray {
     private:
+        using AllocTraits = std::allocator_traits<Alloc>;
+
+        Alloc alloc_{};
         std::size_t capacity_{};
         std::size_t size_{};
         T* p_start_{};
-    
+
+        // @brief           - reserves raw memory. Does NOT construct elements.
+        // @param cap       - number of element slots to reserve
+        // @return          - pointer to first slot, nullptr if cap is 0
+        T* allocate(std::size_t cap);
+
+        // @brief           - frees raw memory. Elements must be destroyed first.
+        // @param p_start   - pointer returned by allocate
+        // @param cap       - number of slots passed to allocate
+        void deallocate(T* p_start, std::size_t cap);
+
+        // @brief           - constructs elements from a range into raw memory.
+        //                    Already built elements are destroyed on exceptions.
+        // @param first     - iterator to first source element
+        // @param last      - iterator past last source element
+        // @param p_dest    - first raw memory slot to construct into
+        template <typename It>
+        void construct_range(It first, It last, T* p_dest);
+
+        // @brief           - constructs copies of fill into raw memory.
+        //                    Already built elements are destroyed on exceptions.
+        // @param p_first   - first raw memory slot to construct into
+        // @param p_last    - slot past last one to construct into
+        // @param fill      - value to copy into every slot
+        void construct_fill(T* p_first, T* p_last, const T& fill);
+
+        // @brief           - destroys live elements, memory stays reserved
+        // @param p_first   - first element to destroy
+        // @param p_last    - element past last one to destroy
+        void destroy(T* p_first, T* p_last);
+
+        // @brief           - moves live elements into a new memory block
+        // @param cap       - number of slots in new block, >= length
+        void reallocate(std::size_t cap);
+
+        // @brief           - increases allocated memory as set by growth policy
+        void grow();
+
+        // @brief           - reallocates once if capacity is below num, growing
+        //                    by at least the growth policy's step
+        // @param num       - number of slots needed
+        void ensure_capacity(std::size_t num);
+
+        // @brief           - checks if a range starts within this array's elements
+        // @param p_vals    - pointer to first element of range
+        // @return          - true if range must be copied before modifying array
+        bool aliases(const T* p_vals);
+
     public:
+        // contiguous iterators are plain pointers into the buffer
+        using iterator = T*;
+        using const_iterator = const T*;
+
         // @brief           - creates new array with a capacity of 10 elements
         // @param cap       - number of elements in array, >0.
+        // @param alloc     - allocator that provides all element memory
         // @note            - defined here to support default argument
-        DynamicArray(std::size_t cap = 10) {
+        DynamicArray(std::size_t cap = 10, const Alloc& alloc = Alloc{}) : alloc_(alloc) {
             // handle 0 capacity error
             if (cap < 1) {
                 throw std::domain_error("Invalid input capacity: " + std::to_string(cap));
             }
 
-            // allocate memory
+            // reserve memory, elements constructed only when added
             this->capacity_ = cap;
-            this->p_start_ = new T[capacity_];
-
-            // for safety, especially if array of pointers initialised
-            for (std::size_t i = 0; i < this->capacity_; ++i) {
-                *(p_start_ + i) = T{};
-            }
+            this->p_start_ = this->allocate(cap);
         }
 
+        // @brief           - creates new array filled with num copies of fill
+        // @param num       - number of elements in array, >0.
+        // @param fill      - value to copy into every element
+        // @param alloc     - allocator that provides all element memory
+        DynamicArray(std::size_t num, const T& fill, const Alloc& alloc = Alloc{});
+
+        // @brief           - copies live elements of other array
+        DynamicArray(const DynamicArray<T,Alloc,Growth>& other);
+
+        // @brief           - copies live elements of other array
+        // @param alloc     - allocator for the copy, instead of other's
+        DynamicArray(const DynamicArray<T,Alloc,Growth>& other, const Alloc& alloc);
+
+        // @brief           - replaces elements with copies of other array's
+        DynamicArray<T,Alloc,Growth>& operator=(const DynamicArray<T,Alloc,Growth>& other);
+
+        // @brief           - takes other array's memory, leaving it empty
+        DynamicArray(DynamicArray<T,Alloc,Growth>&& other) noexcept;
+
+        // @brief           - takes other array's memory, leaving it empty.
+        //                    Moves elements one by one if allocators differ.
+        DynamicArray<T,Alloc,Growth>& operator=(DynamicArray<T,Alloc,Growth>&& other) noexcept(
+            std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value ||
+            std::allocator_traits<Alloc>::is_always_equal::value);
+
+        // @brief           - destroys live elements and frees memory
+        ~DynamicArray();
+
+        // @brief               - returns allocator providing element memory
+        Alloc get_allocator();
+
         // @brief               - returns number of reserved memory blocks
         std::size_t capacity();
 
@@ -53,31 +157,100 @@ class DynamicArray {
         std::size_t length();
 
         // @brief               - indexes some array element
-        // @param idx           - integer between 0 and array cap - 1
+        // @param idx           - integer between 0 and array length - 1
         // @return              - reference to array element selected
         T& at(std::size_t idx);
 
+        // @brief               - indexes some array element, no bounds check
+        // @param idx           - integer between 0 and array length - 1
+        // @return              - reference to array element selected
+        T& operator[](std::size_t idx);
+
+        // @brief               - pointer to first element. Invalidated, like
+        //                        iterators, by any reallocation.
+        T* data();
+
+        // @brief               - contiguous iterator to first element
+        iterator begin();
+
+        // @brief               - contiguous iterator past last element
+        iterator end();
+
+#ifdef __cpp_lib_span
+        // @brief               - view of live elements, e.g. for std algorithms
+        operator std::span<T>();
+#endif
+
         // @brief               - removes last array element
         // @return              - last array element
         T pop();
 
         // @brief               - adds element to end of array
-        // @param val           - value of element
+        // @param val           - value of element, moved into array
         void push(T val);
 
-        // @brief           - creates a new element at specified index, 
+        // @brief               - constructs element in place at end of array
+        // @param args          - arguments forwarded to T's constructor
+        // @return              - reference to new element
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
+
+        // @brief           - creates a new element at specified index,
         //                    shifting other array els. Array size increases.
         // @param val       - value of new element
-        // @param idx       - desired location of new element, 0 <= idx < length
+        // @param idx       - desired location of new element, 0 <= idx <= length
         void insert(T val, std::size_t idx);
 
         // @brief               - sets the value of some array element, without
         //                        modifying other els. Array size unchanged.
-        // @param idx           - integer between 0 and array cap - 1
+        // @param idx           - integer between 0 and array length - 1
         // @param val           - value to set at that el
-        void set(T val, std::size_t idx);        
-
-        // @brief                - increases allocated memory by 2x
+        void set(T val, std::size_t idx);
+
+        // @brief               - finds first element equal to val, with
+        //                        vectorised kernels for arithmetic T
+        // @param val           - value to search for
+        // @return              - index of first match, length if not found
+        std::size_t find(const T& val);
+
+        // @brief               - changes number of elements. New els are copies
+        //                        of fill, surplus els are destroyed.
+        // @param num           - new array length
+        // @param fill          - value of any added elements
+        void resize(std::size_t num, const T& fill = T{});
+
+        // @brief               - adds a range of elements to end of array
+        // @param p_vals        - pointer to first element to copy
+        // @param num           - number of elements to copy
+        void append_range(const T* p_vals, std::size_t num);
+
+        // @brief               - creates copies of a range at specified index,
+        //                        shifting other array els. Array size increases.
+        // @param p_vals        - pointer to first element to copy
+        // @param num           - number of elements to copy
+        // @param idx           - location of first new element, 0 <= idx <= length
+        void insert_range(const T* p_vals, std::size_t num, std::size_t idx);
+
+        // @brief               - removes consecutive elements, shifting later
+        //                        els down. Array size decreases.
+        // @param idx           - location of first element to remove
+        // @param num           - number of elements to remove, idx + num <= length
+        void erase_range(std::size_t idx, std::size_t num);
+
+        // @brief               - replaces all elements with copies of a range
+        // @param p_vals        - pointer to first element to copy
+        // @param num           - number of elements to copy
+        void assign(const T* p_vals, std::size_t num);
+
+        // @brief               - reallocates once so num elements fit
+        // @param num           - number of slots to reserve. No-op if <= capacity.
+        void reserve(std::size_t num);
+
+        // @brief               - frees reserved memory beyond length
+        void shrink_to_fit();
+
+        // @brief                - increases allocated memory by 2x, regardless
+        //                         of growth policy
         void double_capacity();
 
         // @brief                - frees up all allocated memory
@@ -85,131 +258,565 @@ class DynamicArray {
 };
 
 
-/* 
+/*
 Define class
 */
 
+// @brief           - reserves raw memory. Does NOT construct elements.
+// @param cap       - number of element slots to reserve
+// @return          - pointer to first slot, nullptr if cap is 0
+template <typename T, typename Alloc, typename Growth>
+T* DynamicArray<T,Alloc,Growth>::allocate(std::size_t cap) {
+    return (cap) ? AllocTraits::allocate(this->alloc_, cap) : nullptr;
+}
+
+// @brief           - frees raw memory. Elements must be destroyed first.
+// @param p_start   - pointer returned by allocate
+// @param cap       - number of slots passed to allocate
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::deallocate(T* p_start, std::size_t cap) {
+    if (p_start) AllocTraits::deallocate(this->alloc_, p_start, cap);
+}
+
+// @brief           - constructs elements from a range into raw memory.
+//                    Already built elements are destroyed on exceptions.
+// @param first     - iterator to first source element
+// @param last      - iterator past last source element
+// @param p_dest    - first raw memory slot to construct into
+template <typename T, typename Alloc, typename Growth>
+template <typename It>
+void DynamicArray<T,Alloc,Growth>::construct_range(It first, It last, T* p_dest) {
+    T* p_curr = p_dest;
+    try {
+        for (; first != last; ++first, ++p_curr) {
+            AllocTraits::construct(this->alloc_, p_curr, *first);
+        }
+    } catch (...) {
+        this->destroy(p_dest, p_curr);
+        throw;
+    }
+}
+
+// @brief           - constructs copies of fill into raw memory.
+//                    Already built elements are destroyed on exceptions.
+// @param p_first   - first raw memory slot to construct into
+// @param p_last    - slot past last one to construct into
+// @param fill      - value to copy into every slot
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::construct_fill(T* p_first, T* p_last, const T& fill) {
+    T* p_curr = p_first;
+    try {
+        for (; p_curr != p_last; ++p_curr) {
+            AllocTraits::construct(this->alloc_, p_curr, fill);
+        }
+    } catch (...) {
+        this->destroy(p_first, p_curr);
+        throw;
+    }
+}
+
+// @brief           - destroys live elements, memory stays reserved
+// @param p_first   - first element to destroy
+// @param p_last    - element past last one to destroy
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::destroy(T* p_first, T* p_last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; p_first != p_last; ++p_first) {
+            AllocTraits::destroy(this->alloc_, p_first);
+        }
+    }
+}
+
+// @brief           - moves live elements into a new memory block
+// @param cap       - number of slots in new block, >= length
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::reallocate(std::size_t cap) {
+    T* p_start_new = this->allocate(cap);
+
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        // raw byte copy, nothing to destroy afterwards
+        if (this->size_) {
+            std::memcpy(p_start_new, this->p_start_, this->size_ * sizeof(T));
+        }
+    } else {
+        // copy instead of move if a throwing move could lose elements
+        try {
+            if constexpr (std::is_nothrow_move_constructible<T>::value ||
+                          !std::is_copy_constructible<T>::value) {
+                this->construct_range(std::make_move_iterator(this->p_start_),
+                                      std::make_move_iterator(this->p_start_ + this->size_),
+                                      p_start_new);
+            } else {
+                this->construct_range(this->p_start_, this->p_start_ + this->size_, p_start_new);
+            }
+        } catch (...) {
+            this->deallocate(p_start_new, cap);
+            throw;
+        }
+        this->destroy(this->p_start_, this->p_start_ + this->size_);
+    }
+
+    // CAREFULLY free OLD memory, nullify NEW pointer
+    std::size_t old_cap = this->capacity_;
+    this->deallocate(this->p_start_, this->capacity_);
+    this->p_start_ = p_start_new;
+    p_start_new = nullptr;
+    this->capacity_ = cap;
+
+    Growth::on_resize(old_cap, cap);
+}
+
+// @brief           - increases allocated memory as set by growth policy
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::grow() {
+    // always add a slot, e.g. 1.5x of a 1 element or cleared array
+    std::size_t cap = Growth::grow(this->capacity_);
+    this->reallocate((cap > this->capacity_) ? cap : this->capacity_ + 1);
+}
+
+// @brief           - reallocates once if capacity is below num, growing
+//                    by at least the growth policy's step
+// @param num       - number of slots needed
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::ensure_capacity(std::size_t num) {
+    if (num > this->capacity_) {
+        std::size_t cap = Growth::grow(this->capacity_);
+        this->reallocate((num > cap) ? num : cap);
+    }
+}
+
+// @brief           - checks if a range starts within this array's elements
+// @param p_vals    - pointer to first element of range
+// @return          - true if range must be copied before modifying array
+template <typename T, typename Alloc, typename Growth>
+bool DynamicArray<T,Alloc,Growth>::aliases(const T* p_vals) {
+    std::less_equal<const T*> le{};
+    return this->size_ && le(this->p_start_, p_vals) && le(p_vals, this->p_start_ + this->size_ - 1);
+}
+
+// @brief           - creates new array filled with num copies of fill
+// @param num       - number of elements in array, >0.
+// @param fill      - value to copy into every element
+// @param alloc     - allocator that provides all element memory
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::DynamicArray(std::size_t num, const T& fill, const Alloc& alloc)
+    : DynamicArray<T,Alloc,Growth>(num, alloc) {
+    try {
+        this->construct_fill(this->p_start_, this->p_start_ + num, fill);
+    } catch (...) {
+        this->deallocate(this->p_start_, this->capacity_);
+        throw;
+    }
+    this->size_ = num;
+}
+
+// @brief           - copies live elements of other array
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::DynamicArray(const DynamicArray<T,Alloc,Growth>& other)
+    : DynamicArray<T,Alloc,Growth>(other, AllocTraits::select_on_container_copy_construction(other.alloc_)) {}
+
+// @brief           - copies live elements of other array
+// @param alloc     - allocator for the copy, instead of other's
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::DynamicArray(const DynamicArray<T,Alloc,Growth>& other, const Alloc& alloc)
+    : alloc_(alloc) {
+    this->p_start_ = this->allocate(other.capacity_);
+    this->capacity_ = other.capacity_;
+
+    try {
+        this->construct_range(other.p_start_, other.p_start_ + other.size_, this->p_start_);
+    } catch (...) {
+        this->deallocate(this->p_start_, this->capacity_);
+        throw;
+    }
+    this->size_ = other.size_;
+}
+
+// @brief           - replaces elements with copies of other array's
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>& DynamicArray<T,Alloc,Growth>::operator=(const DynamicArray<T,Alloc,Growth>& other) {
+    if (this != &other) {
+        // copy first so this array is untouched if copying throws. Only
+        // allocators that ask for it are copied along with the elements.
+        constexpr bool propagate = AllocTraits::propagate_on_container_copy_assignment::value;
+        DynamicArray<T,Alloc,Growth> copy(other, (propagate) ? other.alloc_ : this->alloc_);
+
+        if constexpr (propagate) std::swap(this->alloc_, copy.alloc_);
+        std::swap(this->capacity_, copy.capacity_);
+        std::swap(this->size_, copy.size_);
+        std::swap(this->p_start_, copy.p_start_);
+    }
+    return *this;
+}
+
+// @brief           - takes other array's memory, leaving it empty
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::DynamicArray(DynamicArray<T,Alloc,Growth>&& other) noexcept
+    : alloc_(std::move(other.alloc_)), capacity_(other.capacity_),
+      size_(other.size_), p_start_(other.p_start_) {
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.p_start_ = nullptr;
+}
+
+// @brief           - takes other array's memory, leaving it empty.
+//                    Moves elements one by one if allocators differ.
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>& DynamicArray<T,Alloc,Growth>::operator=(DynamicArray<T,Alloc,Growth>&& other) noexcept(
+    std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Alloc>::is_always_equal::value) {
+    if (this == &other) return *this;
+
+    constexpr bool propagate = AllocTraits::propagate_on_container_move_assignment::value;
+    this->clear();
+
+    // memory can only change hands if this allocator can free it
+    if (propagate || AllocTraits::is_always_equal::value || this->alloc_ == other.alloc_) {
+        if constexpr (propagate) this->alloc_ = std::move(other.alloc_);
+        std::swap(this->capacity_, other.capacity_);
+        std::swap(this->size_, other.size_);
+        std::swap(this->p_start_, other.p_start_);
+    } else {
+        this->reserve(other.size_);
+        this->construct_range(std::make_move_iterator(other.p_start_),
+                              std::make_move_iterator(other.p_start_ + other.size_),
+                              this->p_start_);
+        this->size_ = other.size_;
+        other.clear();
+    }
+    return *this;
+}
+
+// @brief           - destroys live elements and frees memory
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::~DynamicArray() {
+    this->clear();
+}
+
+// @brief               - returns allocator providing element memory
+template <typename T, typename Alloc, typename Growth>
+Alloc DynamicArray<T,Alloc,Growth>::get_allocator() {
+    return this->alloc_;
+}
+
 // @brief               - returns number of reserved memory blocks
-template <typename T>
-std::size_t DynamicArray<T>::capacity() {
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T,Alloc,Growth>::capacity() {
     return this->capacity_;
 }
 
 // @brief               - returns number of occupied memory blocks
-template <typename T>
-std::size_t DynamicArray<T>::length() {
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T,Alloc,Growth>::length() {
     return this->size_;
 }
 
 // @brief                - indexes some array element
-// @param idx           - integer between 0 and array size - 1
+// @param idx           - integer between 0 and array length - 1
 // @return              - reference to array element selected
-template <typename T>
-T& DynamicArray<T>::at(std::size_t idx) {
-    if (idx >= this->capacity_) {
+template <typename T, typename Alloc, typename Growth>
+T& DynamicArray<T,Alloc,Growth>::at(std::size_t idx) {
+    if (idx >= this->size_) {
         throw std::range_error("Invalid input index: " + std::to_string(idx));
     }
 
     return *(this->p_start_ + idx);
 }
 
+// @brief               - indexes some array element, no bounds check
+// @param idx           - integer between 0 and array length - 1
+// @return              - reference to array element selected
+template <typename T, typename Alloc, typename Growth>
+T& DynamicArray<T,Alloc,Growth>::operator[](std::size_t idx) {
+    return *(this->p_start_ + idx);
+}
+
+// @brief               - pointer to first element. Invalidated, like
+//                        iterators, by any reallocation.
+template <typename T, typename Alloc, typename Growth>
+T* DynamicArray<T,Alloc,Growth>::data() {
+    return this->p_start_;
+}
+
+// @brief               - contiguous iterator to first element
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T,Alloc,Growth>::iterator DynamicArray<T,Alloc,Growth>::begin() {
+    return this->p_start_;
+}
+
+// @brief               - contiguous iterator past last element
+template <typename T, typename Alloc, typename Growth>
+typename DynamicArray<T,Alloc,Growth>::iterator DynamicArray<T,Alloc,Growth>::end() {
+    return this->p_start_ + this->size_;
+}
+
+#ifdef __cpp_lib_span
+// @brief               - view of live elements, e.g. for std algorithms
+template <typename T, typename Alloc, typename Growth>
+DynamicArray<T,Alloc,Growth>::operator std::span<T>() {
+    return std::span<T>(this->p_start_, this->size_);
+}
+#endif
+
 // @brief                - removes last array element
 // @return              - last array element
-template <typename T>
-T DynamicArray<T>::pop() {
+template <typename T, typename Alloc, typename Growth>
+T DynamicArray<T,Alloc,Growth>::pop() {
     if (this->size_ == 0) {
         throw std::range_error("No elements to pop");
     }
 
-    T el = *(this->p_start_ + this->size_ - 1);
-    // reset memory block for security
-    *(this->p_start_ + this->size_ - 1) = T{};
+    T el = std::move(*(this->p_start_ + this->size_ - 1));
+    // end element lifetime, memory block stays reserved
+    this->destroy(this->p_start_ + this->size_ - 1, this->p_start_ + this->size_);
     --this->size_;
     return el;
 }
 
 // @brief               - adds element to end of array
-// @param val           - value of element
-template <typename T>
-void DynamicArray<T>::push(T val) {
+// @param val           - value of element, moved into array
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::push(T val) {
     // avoid overwriting unreserved data
     if (this->size_ >= this->capacity_) {
-        double_capacity();
-    } 
+        this->grow();
+    }
 
+    AllocTraits::construct(this->alloc_, this->p_start_ + this->size_, std::move(val));
     ++this->size_;
-    *(this->p_start_ + this->size_ - 1) = val;
 }
 
-// @brief           - creates a new element at specified index, 
+// @brief               - constructs element in place at end of array
+// @param args          - arguments forwarded to T's constructor
+// @return              - reference to new element
+template <typename T, typename Alloc, typename Growth>
+template <typename... Args>
+T& DynamicArray<T,Alloc,Growth>::emplace_back(Args&&... args) {
+    // args may refer to an element, so build first if growth would move it
+    if (this->size_ >= this->capacity_) {
+        T val(std::forward<Args>(args)...);
+        this->grow();
+        AllocTraits::construct(this->alloc_, this->p_start_ + this->size_, std::move(val));
+    } else {
+        AllocTraits::construct(this->alloc_, this->p_start_ + this->size_, std::forward<Args>(args)...);
+    }
+
+    ++this->size_;
+    return *(this->p_start_ + this->size_ - 1);
+}
+
+// @brief           - creates a new element at specified index,
 //                    shifting other array els. Array size increases.
 // @param val       - value of new element
-// @param idx       - desired location of new element, 0 <= idx < length
-template <typename T>
-void DynamicArray<T>::insert(T val, std::size_t idx) {
+// @param idx       - desired location of new element, 0 <= idx <= length
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::insert(T val, std::size_t idx) {
+    if (idx > this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
     // handle special cases
-    if (idx == this->size_ - 1) {
-        this->push(val);
-    } else if (this->size_ > this->capacity_ - 2) {
-        double_capacity();
+    if (idx == this->size_) {
+        this->push(std::move(val));
+        return;
+    } else if (this->size_ >= this->capacity_) {
+        this->grow();
     }
 
+    T* p_idx = this->p_start_ + idx;
+    T* p_end = this->p_start_ + this->size_;
+
     // shift other elements
-    for (int i = this->size_ -1; i >= int(idx); --i) {
-        *(this->p_start_ + i + 1) = *(this->p_start_ + i);
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(p_idx + 1, p_idx, (this->size_ - idx) * sizeof(T));
+        AllocTraits::construct(this->alloc_, p_idx, std::move(val));
+    } else {
+        // last element moves into raw memory, the rest into live elements
+        AllocTraits::construct(this->alloc_, p_end, std::move(*(p_end - 1)));
+        std::move_backward(p_idx, p_end - 1, p_end);
+        *p_idx = std::move(val);
     }
 
-    // insert new el
-    *(this->p_start_ + idx) = val;
     ++this->size_;
 }
 
 // @brief               - sets the value of some array element, without
 //                        modifying other els. Array size unchanged.
-// @warning             - only use on EXISTING elements. Else size_ inaccurate
-// @param idx           - integer between 0 and array cap - 1
+// @param idx           - integer between 0 and array length - 1
 // @param val           - value to set at that el
-template <typename T>
-void DynamicArray<T>::set(T val, std::size_t idx) {
-    if (idx >= this->capacity_) {
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::set(T val, std::size_t idx) {
+    if (idx >= this->size_) {
         throw std::range_error("Invalid input index: " + std::to_string(idx));
     }
 
-    *(this->p_start_ + idx) = val;
+    *(this->p_start_ + idx) = std::move(val);
 }
 
-// @brief                - copies current data into 2x as large array
-template <typename T>
-void DynamicArray<T>::double_capacity() {
-    T* p_start_new = new T[this->capacity_*2];
+// @brief               - finds first element equal to val, with
+//                        vectorised kernels for arithmetic T
+// @param val           - value to search for
+// @return              - index of first match, length if not found
+template <typename T, typename Alloc, typename Growth>
+std::size_t DynamicArray<T,Alloc,Growth>::find(const T& val) {
+    return SimdKernels::find(this->p_start_, this->size_, val);
+}
 
-    // clear old data for security as we go.
-    for (std::size_t i = 0; i < this->capacity_; ++i) {
-        *(p_start_new + i) = *(this->p_start_ + i);
-        *(this->p_start_ + i) = T{};
+// @brief               - changes number of elements. New els are copies
+//                        of fill, surplus els are destroyed.
+// @param num           - new array length
+// @param fill          - value of any added elements
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::resize(std::size_t num, const T& fill) {
+    if (num > this->capacity_) {
+        this->reallocate(num);
     }
 
-    // CAREFULLY free OLD memory, nullify NEW pointer
-    delete[] this->p_start_;
-    this->p_start_ = p_start_new;
-    p_start_new = nullptr;
-    this->capacity_ *= 2;
+    if (num > this->size_) {
+        this->construct_fill(this->p_start_ + this->size_, this->p_start_ + num, fill);
+    } else {
+        this->destroy(this->p_start_ + num, this->p_start_ + this->size_);
+    }
+    this->size_ = num;
+}
 
-    std::cout << "info: capacity doubled to " + std::to_string(this->capacity_) << std::endl;
+// @brief               - adds a range of elements to end of array
+// @param p_vals        - pointer to first element to copy
+// @param num           - number of elements to copy
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::append_range(const T* p_vals, std::size_t num) {
+    this->insert_range(p_vals, num, this->size_);
 }
 
-// @brief                - frees up allocated memory
-template <typename T>
-void DynamicArray<T>::clear()  {
-    // clear elements for security
-    for (std::size_t i = 0; i < this->size_; ++i) {
-        *(this->p_start_ + this->size_ - 1) = T{};
+// @brief               - creates copies of a range at specified index,
+//                        shifting other array els. Array size increases.
+// @param p_vals        - pointer to first element to copy
+// @param num           - number of elements to copy
+// @param idx           - location of first new element, 0 <= idx <= length
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::insert_range(const T* p_vals, std::size_t num, std::size_t idx) {
+    if (idx > this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+    if (num == 0) return;
+
+    // copy own elements out first, growth/shifting would invalidate them
+    if (this->aliases(p_vals)) {
+        DynamicArray<T,Alloc,Growth> copy(num, this->alloc_);
+        copy.append_range(p_vals, num);
+        this->insert_range(copy.p_start_, num, idx);
+        return;
+    }
+
+    // reserve once for the whole range
+    this->ensure_capacity(this->size_ + num);
+    T* p_idx = this->p_start_ + idx;
+    T* p_end = this->p_start_ + this->size_;
+    std::size_t after = this->size_ - idx;
+
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(p_idx + num, p_idx, after * sizeof(T));
+        std::memcpy(p_idx, p_vals, num * sizeof(T));
+    } else if (after > num) {
+        // last num els move into raw memory, the rest shift as one block
+        this->construct_range(std::make_move_iterator(p_end - num),
+                              std::make_move_iterator(p_end), p_end);
+        std::move_backward(p_idx, p_end - num, p_end);
+        std::copy(p_vals, p_vals + num, p_idx);
+    } else {
+        // range overhangs the old end, so its tail goes into raw memory
+        this->construct_range(p_vals + after, p_vals + num, p_end);
+        try {
+            this->construct_range(std::make_move_iterator(p_idx),
+                                  std::make_move_iterator(p_end), p_idx + num);
+        } catch (...) {
+            this->destroy(p_end, p_end + num - after);
+            throw;
+        }
+        std::copy(p_vals, p_vals + after, p_idx);
+    }
+
+    this->size_ += num;
+}
+
+// @brief               - removes consecutive elements, shifting later
+//                        els down. Array size decreases.
+// @param idx           - location of first element to remove
+// @param num           - number of elements to remove, idx + num <= length
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::erase_range(std::size_t idx, std::size_t num) {
+    if (idx > this->size_ || num > this->size_ - idx) {
+        throw std::range_error("Invalid input range: " + std::to_string(idx) +
+                               " + " + std::to_string(num));
+    }
+
+    T* p_idx = this->p_start_ + idx;
+    T* p_end = this->p_start_ + this->size_;
+
+    // shift later elements down as one block
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(p_idx, p_idx + num, (this->size_ - idx - num) * sizeof(T));
+    } else {
+        std::move(p_idx + num, p_end, p_idx);
+        this->destroy(p_end - num, p_end);
+    }
+
+    this->size_ -= num;
+}
+
+// @brief               - replaces all elements with copies of a range
+// @param p_vals        - pointer to first element to copy
+// @param num           - number of elements to copy
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::assign(const T* p_vals, std::size_t num) {
+    // copy own elements out first, destroying would invalidate them
+    if (num && this->aliases(p_vals)) {
+        DynamicArray<T,Alloc,Growth> copy(num, this->alloc_);
+        copy.append_range(p_vals, num);
+        this->assign(copy.p_start_, num);
+        return;
     }
-    
+
+    this->destroy(this->p_start_, this->p_start_ + this->size_);
+    this->size_ = 0;
+    this->insert_range(p_vals, num, 0);
+}
+
+// @brief               - reallocates once so num elements fit
+// @param num           - number of slots to reserve. No-op if <= capacity.
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::reserve(std::size_t num) {
+    if (num > this->capacity_) {
+        this->reallocate(num);
+    }
+}
+
+// @brief               - frees reserved memory beyond length
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::shrink_to_fit() {
+    if (this->size_ < this->capacity_) {
+        this->reallocate(this->size_);
+    }
+}
+
+// @brief                - moves current data into 2x as large array,
+//                         regardless of growth policy
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::double_capacity() {
+    // cleared arrays have no capacity to double
+    this->reallocate((this->capacity_) ? this->capacity_ * 2 : 1);
+}
+
+// @brief                - frees up allocated memory
+template <typename T, typename Alloc, typename Growth>
+void DynamicArray<T,Alloc,Growth>::clear()  {
+    // only live elements were ever constructed
+    this->destroy(this->p_start_, this->p_start_ + this->size_);
+    this->deallocate(this->p_start_, this->capacity_);
+
     this->size_ = 0;
     this->capacity_ = 0;
-    delete[] this->p_start_;
     this->p_start_ = nullptr;
 }
 
-#endif
\ No newline at end of file
+#endif
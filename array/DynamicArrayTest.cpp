@@ -8,9 +8,18 @@
 // =======================================================================================
 
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include "./DynamicArray.hpp"
 
+// 1.5x growth that reports every reallocation
+struct LoggedGrowth : ThreeHalvesGrowth {
+    static void on_resize(std::size_t old_cap, std::size_t new_cap) {
+        std::cout << "info: capacity " << old_cap << " -> " << new_cap << std::endl;
+    }
+};
+
 int main() {
     DynamicArray<int> a_test;
 
@@ -38,6 +47,71 @@ int main() {
     std::cout << "Popped: " + std::to_string(a_test.pop()); 
     std::cout << ". Size: " + std::to_string(a_test.length()) << std::endl;
 
+    // bulk range operations
+    int batch[5] = {7, 8, 9, 10, 11};
+    a_test.append_range(batch, 5);
+    std::cout << "Appended range: " + std::to_string(a_test.length());
+    std::cout << ". Last: " + std::to_string(a_test.at(a_test.length() - 1)) << std::endl;
+
+    a_test.insert_range(batch, 3, 1);
+    std::cout << "Inserted range: " + std::to_string(a_test.at(1)) + " ";
+    std::cout << std::to_string(a_test.at(3)) + " " + std::to_string(a_test.at(4)) << std::endl;
+
+    a_test.erase_range(1, 3);
+    std::cout << "Erased range: " + std::to_string(a_test.length());
+    std::cout << ". Now at 1: " + std::to_string(a_test.at(1)) << std::endl;
+
+    a_test.assign(batch, 2);
+    std::cout << "Assigned: " + std::to_string(a_test.length());
+    std::cout << ". First: " + std::to_string(a_test.at(0)) << std::endl;
+
+    DynamicArray<std::string> s_test(2);
+    std::string words[3] = {"b", "c", "d"};
+    s_test.push("a");
+    s_test.push("e");
+    s_test.insert_range(words, 3, 1);
+    s_test.erase_range(0, 1);
+    std::cout << "Strings: ";
+    for (std::size_t i = 0; i < s_test.length(); ++i) {
+        std::cout << s_test.at(i) << " ";
+    }
+    std::cout << std::endl;
+
+    // iterators and unchecked indexing
+    int total = 0;
+    for (int el : a_test) {
+        total += el;
+    }
+    std::cout << "Iterated sum: " + std::to_string(total);
+    std::cout << ". Via data/[]: " + std::to_string(a_test.data()[1] + a_test[0]) << std::endl;
+
+    // reserve and shrink
+    a_test.reserve(100);
+    std::cout << "Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+    a_test.shrink_to_fit();
+    std::cout << "Shrunk: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // growth policies and resize hook
+    DynamicArray<int, std::allocator<int>, LoggedGrowth> g_test(4);
+    for (int i = 0; i < 10; ++i) {
+        g_test.push(i);
+    }
+    DynamicArray<int, std::allocator<int>, FixedStepGrowth<3>> f_test(1);
+    for (int i = 0; i < 10; ++i) {
+        f_test.push(i);
+    }
+    std::cout << "Fixed step capacity: " + std::to_string(f_test.capacity()) << std::endl;
+
+    // move and emplace
+    DynamicArray<std::string> e_test(1);
+    e_test.emplace_back(3, 'x');
+    e_test.emplace_back("yy");
+    DynamicArray<std::string> e_moved(std::move(e_test));
+    std::cout << "Emplaced then moved: " + e_moved.at(0) + " " + e_moved.at(1);
+    std::cout << ", source length: " + std::to_string(e_test.length()) << std::endl;
+    e_test = std::move(e_moved);
+    std::cout << "Move assigned length: " + std::to_string(e_test.length()) << std::endl;
+
     // clear
     a_test.clear();
     std::cout << "Cleared: " + std::to_string(a_test.length()) << std::endl;
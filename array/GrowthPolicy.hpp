@@ -0,0 +1,54 @@
+// @file         - GrowthPolicy.hpp
+// @brief        - Defining capacity growth policies for dynamic arrays
+// @author       - Madhav Malhotra
+// @date         - 2023-12-24
+// @version      - 0.0.0
+// =============================================================================
+
+#ifndef GROWTHPOLICY_HPP
+#define GROWTHPOLICY_HPP
+
+#include <cstddef>
+
+/*
+Every policy provides:
+    grow(cap)               - next capacity once cap is full
+    on_resize(old, new)     - called after every reallocation. Empty by
+                              default so it compiles away. Derive from a
+                              policy and hide it to log or count resizes.
+*/
+
+// @brief           - grows capacity by 2x. Fewest reallocations.
+struct DoublingGrowth {
+    static std::size_t grow(std::size_t cap) {
+        return cap * 2;
+    }
+
+    static void on_resize(std::size_t, std::size_t) {}
+};
+
+// @brief           - grows capacity by 1.5x. Lets freed blocks be reused.
+struct ThreeHalvesGrowth {
+    static std::size_t grow(std::size_t cap) {
+        return cap + cap / 2;
+    }
+
+    static void on_resize(std::size_t, std::size_t) {}
+};
+
+// @brief           - grows capacity by a fixed number of elements. Bounds
+//                    unused memory on memory-constrained nodes, but pushes
+//                    are no longer amortised O(1).
+// @param Step      - elements added per growth, >0
+template <std::size_t Step>
+struct FixedStepGrowth {
+    static_assert(Step > 0, "FixedStepGrowth requires a step of 1+");
+
+    static std::size_t grow(std::size_t cap) {
+        return cap + Step;
+    }
+
+    static void on_resize(std::size_t, std::size_t) {}
+};
+
+#endif
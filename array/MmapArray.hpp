@@ -0,0 +1,409 @@
+// @file         - MmapArray.hpp
+// @brief        - Declaring a dynamic array backed by a memory mapped file,
+//                 so large arrays persist across runs and reopen instantly
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - Linux only, grows with ftruncate + mremap. Elements must be
+//                 trivially copyable since they're stored as raw file bytes.
+// =============================================================================
+
+#ifndef MMAPARRAY_H
+#define MMAPARRAY_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "./GrowthPolicy.hpp"
+
+/*
+Declare class
+*/
+
+// File layout: 64 byte header, then capacity element slots. Length and
+// capacity live in the mapped header, so reopening reads no elements.
+template <typename T, typename Growth = DoublingGrowth>
+class MmapArray {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MmapArray requires trivially copyable elements");
+    static_assert(alignof(T) <= 64, "MmapArray requires alignment of 64 or less");
+
+    private:
+        struct Header {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t el_size;
+            std::uint64_t size;
+            std::uint64_t capacity;
+        };
+
+        static constexpr std::size_t HEADER_BYTES = 64;
+        static constexpr std::uint64_t MAGIC = 0x5941525241504d4dULL; // "MMPARRAY"
+        static constexpr std::uint32_t VERSION = 0;
+
+        std::string path_{};
+        int fd_{-1};
+        unsigned char* p_map_{};
+        std::size_t map_bytes_{};
+
+        // @brief           - header at the start of the mapping
+        Header* header();
+
+        // @brief           - first element slot, just past the header
+        T* elements();
+
+        // @brief           - file size needed for cap elements
+        // @param cap       - number of element slots
+        static std::size_t bytes_for(std::size_t cap);
+
+        // @brief           - unmaps and closes file, then throws errno as an error
+        // @param what      - name of failed call
+        [[noreturn]] void fail(const std::string& what);
+
+        // @brief           - resizes file and mapping. Mapping may move.
+        // @param cap       - number of slots in resized file, >= length
+        void remap(std::size_t cap);
+
+        // @brief           - increases file size as set by growth policy
+        void grow();
+
+    public:
+        // @brief           - opens array stored at path, or creates it if the
+        //                    file is missing or empty
+        // @param path      - file backing the array
+        // @param cap       - number of slots in a new file, >0. Ignored on reopen.
+        MmapArray(const std::string& path, std::size_t cap = 10);
+
+        // a mapping has one owner, copy with data() if needed
+        MmapArray(const MmapArray<T,Growth>& other) = delete;
+        MmapArray<T,Growth>& operator=(const MmapArray<T,Growth>& other) = delete;
+
+        // @brief           - unmaps and closes file. Kernel writes back dirty
+        //                    pages, call sync() first to wait for the disk.
+        ~MmapArray();
+
+        // @brief           - returns number of reserved memory blocks
+        std::size_t capacity();
+
+        // @brief           - returns number of occupied memory blocks
+        std::size_t length();
+
+        // @brief           - indexes some array element
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& at(std::size_t idx);
+
+        // @brief           - indexes some array element without bounds checks
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& operator[](std::size_t idx);
+
+        // @brief           - pointer to first element. Invalidated by growth.
+        T* data();
+
+        // @brief           - removes last array element
+        // @return          - last array element
+        T pop();
+
+        // @brief           - adds element to end of array
+        // @param val       - value of element
+        void push(T val);
+
+        // @brief           - creates a new element at specified index,
+        //                    shifting other array els. Array size increases.
+        // @param val       - value of new element
+        // @param idx       - desired location of new element, 0 <= idx <= length
+        void insert(T val, std::size_t idx);
+
+        // @brief           - sets the value of some array element, without
+        //                    modifying other els. Array size unchanged.
+        // @param idx       - integer between 0 and array length - 1
+        // @param val       - value to set at that el
+        void set(T val, std::size_t idx);
+
+        // @brief           - grows file once so num elements fit
+        // @param num       - number of slots to reserve. No-op if <= capacity.
+        void reserve(std::size_t num);
+
+        // @brief           - increases file size by 2x
+        void double_capacity();
+
+        // @brief           - deletes all elements, truncating file to its header
+        void clear();
+
+        // @brief           - blocks until all changes are written to the file
+        void sync();
+};
+
+
+/*
+Define class - in hpp file due to template issues
+*/
+
+// @brief           - header at the start of the mapping
+template <typename T, typename Growth>
+typename MmapArray<T,Growth>::Header* MmapArray<T,Growth>::header() {
+    return reinterpret_cast<Header*>(this->p_map_);
+}
+
+// @brief           - first element slot, just past the header
+template <typename T, typename Growth>
+T* MmapArray<T,Growth>::elements() {
+    return reinterpret_cast<T*>(this->p_map_ + HEADER_BYTES);
+}
+
+// @brief           - file size needed for cap elements
+// @param cap       - number of element slots
+template <typename T, typename Growth>
+std::size_t MmapArray<T,Growth>::bytes_for(std::size_t cap) {
+    return HEADER_BYTES + cap * sizeof(T);
+}
+
+// @brief           - unmaps and closes file, then throws errno as an error
+// @param what      - name of failed call
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::fail(const std::string& what) {
+    int err = errno;
+    if (this->p_map_) {
+        munmap(this->p_map_, this->map_bytes_);
+        this->p_map_ = nullptr;
+    }
+    if (this->fd_ >= 0) {
+        close(this->fd_);
+        this->fd_ = -1;
+    }
+    throw std::system_error(err, std::generic_category(), what + " " + this->path_);
+}
+
+// @brief           - resizes file and mapping. Mapping may move.
+// @param cap       - number of slots in resized file, >= length
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::remap(std::size_t cap) {
+    std::size_t old_cap = this->header()->capacity;
+    std::size_t bytes = bytes_for(cap);
+
+    // file must cover the mapping before it's touched, so grow the file
+    // first and shrink the mapping first
+    if (bytes > this->map_bytes_ && ftruncate(this->fd_, bytes) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate " + this->path_);
+    }
+
+    void* p_new = mremap(this->p_map_, this->map_bytes_, bytes, MREMAP_MAYMOVE);
+    if (p_new == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mremap " + this->path_);
+    }
+    this->p_map_ = static_cast<unsigned char*>(p_new);
+    this->map_bytes_ = bytes;
+
+    if (bytes < bytes_for(old_cap) && ftruncate(this->fd_, bytes) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate " + this->path_);
+    }
+    this->header()->capacity = cap;
+
+    Growth::on_resize(old_cap, cap);
+}
+
+// @brief           - increases file size as set by growth policy
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::grow() {
+    // always add a slot, e.g. 1.5x of a 1 element or cleared array
+    std::size_t old_cap = this->header()->capacity;
+    std::size_t cap = Growth::grow(old_cap);
+    this->remap((cap > old_cap) ? cap : old_cap + 1);
+}
+
+// @brief           - opens array stored at path, or creates it if the
+//                    file is missing or empty
+// @param path      - file backing the array
+// @param cap       - number of slots in a new file, >0. Ignored on reopen.
+template <typename T, typename Growth>
+MmapArray<T,Growth>::MmapArray(const std::string& path, std::size_t cap) : path_(path) {
+    // handle 0 capacity error
+    if (cap < 1) {
+        throw std::domain_error("Invalid input capacity: " + std::to_string(cap));
+    }
+
+    this->fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (this->fd_ < 0) {
+        this->fail("open");
+    }
+
+    struct stat st{};
+    if (fstat(this->fd_, &st) != 0) {
+        this->fail("fstat");
+    }
+
+    bool created = (st.st_size == 0);
+    if (created && ftruncate(this->fd_, bytes_for(cap)) != 0) {
+        this->fail("ftruncate");
+    }
+    this->map_bytes_ = (created) ? bytes_for(cap) : static_cast<std::size_t>(st.st_size);
+
+    void* p_map = mmap(nullptr, this->map_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd_, 0);
+    if (p_map == MAP_FAILED) {
+        this->fail("mmap");
+    }
+    this->p_map_ = static_cast<unsigned char*>(p_map);
+
+    if (created) {
+        *this->header() = Header{MAGIC, VERSION, sizeof(T), 0, cap};
+        return;
+    }
+
+    // reopened files must hold this element type and match their header
+    Header* p_head = this->header();
+    if (this->map_bytes_ < HEADER_BYTES || p_head->magic != MAGIC ||
+        p_head->version != VERSION || p_head->el_size != sizeof(T) ||
+        p_head->size > p_head->capacity || bytes_for(p_head->capacity) != this->map_bytes_) {
+        errno = EINVAL;
+        this->fail("Invalid array file");
+    }
+}
+
+// @brief           - unmaps and closes file. Kernel writes back dirty
+//                    pages, call sync() first to wait for the disk.
+template <typename T, typename Growth>
+MmapArray<T,Growth>::~MmapArray() {
+    munmap(this->p_map_, this->map_bytes_);
+    close(this->fd_);
+}
+
+// @brief           - returns number of reserved memory blocks
+template <typename T, typename Growth>
+std::size_t MmapArray<T,Growth>::capacity() {
+    return this->header()->capacity;
+}
+
+// @brief           - returns number of occupied memory blocks
+template <typename T, typename Growth>
+std::size_t MmapArray<T,Growth>::length() {
+    return this->header()->size;
+}
+
+// @brief           - indexes some array element
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, typename Growth>
+T& MmapArray<T,Growth>::at(std::size_t idx) {
+    if (idx >= this->header()->size) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    return this->elements()[idx];
+}
+
+// @brief           - indexes some array element without bounds checks
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, typename Growth>
+T& MmapArray<T,Growth>::operator[](std::size_t idx) {
+    return this->elements()[idx];
+}
+
+// @brief           - pointer to first element. Invalidated by growth.
+template <typename T, typename Growth>
+T* MmapArray<T,Growth>::data() {
+    return this->elements();
+}
+
+// @brief           - removes last array element
+// @return          - last array element
+template <typename T, typename Growth>
+T MmapArray<T,Growth>::pop() {
+    if (this->header()->size == 0) {
+        throw std::range_error("No elements to pop");
+    }
+
+    --this->header()->size;
+    return this->elements()[this->header()->size];
+}
+
+// @brief           - adds element to end of array
+// @param val       - value of element
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::push(T val) {
+    // avoid writing past end of file
+    if (this->header()->size >= this->header()->capacity) {
+        this->grow();
+    }
+
+    this->elements()[this->header()->size] = val;
+    ++this->header()->size;
+}
+
+// @brief           - creates a new element at specified index,
+//                    shifting other array els. Array size increases.
+// @param val       - value of new element
+// @param idx       - desired location of new element, 0 <= idx <= length
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::insert(T val, std::size_t idx) {
+    std::size_t size = this->header()->size;
+    if (idx > size) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    if (size >= this->header()->capacity) {
+        this->grow();
+    }
+
+    T* p_idx = this->elements() + idx;
+    std::memmove(p_idx + 1, p_idx, (size - idx) * sizeof(T));
+    *p_idx = val;
+    ++this->header()->size;
+}
+
+// @brief           - sets the value of some array element, without
+//                    modifying other els. Array size unchanged.
+// @param idx       - integer between 0 and array length - 1
+// @param val       - value to set at that el
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::set(T val, std::size_t idx) {
+    if (idx >= this->header()->size) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    this->elements()[idx] = val;
+}
+
+// @brief           - grows file once so num elements fit
+// @param num       - number of slots to reserve. No-op if <= capacity.
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::reserve(std::size_t num) {
+    if (num > this->header()->capacity) {
+        this->remap(num);
+    }
+}
+
+// @brief           - increases file size by 2x
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::double_capacity() {
+    // cleared arrays have no capacity to double
+    std::size_t cap = this->header()->capacity;
+    this->remap((cap) ? cap * 2 : 1);
+}
+
+// @brief           - deletes all elements, truncating file to its header
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::clear() {
+    this->header()->size = 0;
+    this->remap(0);
+}
+
+// @brief           - blocks until all changes are written to the file
+template <typename T, typename Growth>
+void MmapArray<T,Growth>::sync() {
+    if (msync(this->p_map_, this->map_bytes_, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "msync " + this->path_);
+    }
+}
+
+#endif
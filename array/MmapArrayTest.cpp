@@ -0,0 +1,82 @@
+// @file         - MmapArrayTest.cpp
+// @brief        - Testing a file backed dynamic array, including reopening
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include "./MmapArray.hpp"
+
+int main() {
+    const std::string path = "/tmp/MmapArrayTest.bin";
+    std::remove(path.c_str());
+
+    {
+        MmapArray<int> a_test(path, 4);
+
+        // Getter methods
+        std::cout << "Initialised elements: " + std::to_string(a_test.length()) << std::endl;
+        std::cout << "Reserved blocks: " + std::to_string(a_test.capacity()) << std::endl;
+
+        // add elements, grows the file
+        for (int i = 1; i < 11; ++i) {
+            a_test.push(i);
+        }
+        std::cout << "Size after pushes: " + std::to_string(a_test.length());
+        std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+        a_test.insert(100, 0);
+        a_test.set(200, 1);
+        std::cout << "Popped: " + std::to_string(a_test.pop()) << std::endl;
+
+        // out of range index
+        try {
+            a_test.at(10);
+        } catch (const std::range_error& e) {
+            std::cout << "Caught: " << e.what() << std::endl;
+        }
+
+        a_test.sync();
+    }
+
+    // reopen, elements persist without being rebuilt
+    {
+        MmapArray<int> a_reopen(path, 1);
+        std::cout << "Reopened: " + std::to_string(a_reopen.length());
+        std::cout << ". Reserved: " + std::to_string(a_reopen.capacity()) << std::endl;
+        std::cout << "Elements: ";
+        for (std::size_t i = 0; i < a_reopen.length(); ++i) {
+            std::cout << a_reopen.at(i) << " ";
+        }
+        std::cout << std::endl;
+
+        a_reopen.reserve(1000);
+        std::cout << "Reserved after reserve: " + std::to_string(a_reopen.capacity());
+        std::cout << ". Last: " + std::to_string(a_reopen.at(a_reopen.length() - 1)) << std::endl;
+    }
+
+    // element type mismatch is rejected
+    try {
+        MmapArray<double> a_wrong(path);
+    } catch (const std::system_error& e) {
+        std::cout << "Caught wrong element type" << std::endl;
+    }
+
+    // clear truncates file, array still usable
+    {
+        MmapArray<int> a_clear(path);
+        a_clear.clear();
+        std::cout << "Cleared: " + std::to_string(a_clear.length());
+        std::cout << ". Reserved: " + std::to_string(a_clear.capacity()) << std::endl;
+        a_clear.push(7);
+        std::cout << "Pushed after clear: " + std::to_string(a_clear.at(0)) << std::endl;
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
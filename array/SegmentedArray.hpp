@@ -0,0 +1,447 @@
+// @file         - SegmentedArray.hpp
+// @brief        - Declaring a dynamic array stored in fixed size chunks, so
+//                 growth never moves or copies existing elements
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.1.0
+// @since 0.0.0  - Move constructor/assignment and emplace_back
+// @note         - element addresses stay valid until the element is removed.
+//                 Growth only copies the chunk directory, one pointer per chunk.
+// =============================================================================
+
+#ifndef SEGMENTEDARRAY_H
+#define SEGMENTEDARRAY_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "./DynamicArray.hpp"
+#include "./SimdKernels.hpp"
+
+/*
+Declare class
+*/
+
+template <typename T, std::size_t ChunkBits = 12, typename Alloc = std::allocator<T>>
+class SegmentedArray {
+    static_assert(ChunkBits > 0 && ChunkBits < 32, "SegmentedArray requires 1-31 chunk bits");
+
+    private:
+        using AllocTraits = std::allocator_traits<Alloc>;
+        using ChunkAlloc = typename AllocTraits::template rebind_alloc<T*>;
+
+        // elements per chunk, element idx is in chunk idx >> ChunkBits at idx & MASK
+        static constexpr std::size_t CHUNK = std::size_t{1} << ChunkBits;
+        static constexpr std::size_t MASK = CHUNK - 1;
+
+        Alloc alloc_{};
+        std::size_t size_{};
+        DynamicArray<T*, ChunkAlloc> chunks_;
+
+        // @brief           - pointer to slot of some element, live or not
+        // @param idx       - integer between 0 and capacity - 1
+        T* slot(std::size_t idx);
+
+        // @brief           - allocates one more chunk of raw memory
+        void add_chunk();
+
+    public:
+        // @brief           - creates new array with room for cap elements
+        // @param cap       - number of elements to reserve, rounded up to
+        //                    whole chunks. >0.
+        // @param alloc     - allocator that provides all element memory
+        SegmentedArray(std::size_t cap = 10, const Alloc& alloc = Alloc{});
+
+        // @brief           - creates new array filled with num copies of fill
+        // @param num       - number of elements in array, >0.
+        // @param fill      - value to copy into every element
+        // @param alloc     - allocator that provides all element memory
+        SegmentedArray(std::size_t num, const T& fill, const Alloc& alloc = Alloc{});
+
+        // @brief           - copies live elements of other array
+        SegmentedArray(const SegmentedArray<T,ChunkBits,Alloc>& other);
+
+        // @brief           - replaces elements with copies of other array's
+        SegmentedArray<T,ChunkBits,Alloc>& operator=(const SegmentedArray<T,ChunkBits,Alloc>& other);
+
+        // @brief           - takes other array's chunks, leaving it empty
+        SegmentedArray(SegmentedArray<T,ChunkBits,Alloc>&& other) noexcept;
+
+        // @brief           - takes other array's chunks, leaving it empty.
+        //                    Moves elements one by one if allocators differ.
+        SegmentedArray<T,ChunkBits,Alloc>& operator=(SegmentedArray<T,ChunkBits,Alloc>&& other);
+
+        // @brief           - destroys live elements and frees all chunks
+        ~SegmentedArray();
+
+        // @brief           - returns allocator providing element memory
+        Alloc get_allocator();
+
+        // @brief           - returns number of reserved memory blocks
+        std::size_t capacity();
+
+        // @brief           - returns number of occupied memory blocks
+        std::size_t length();
+
+        // @brief           - indexes some array element
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& at(std::size_t idx);
+
+        // @brief           - indexes some array element, no bounds check
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& operator[](std::size_t idx);
+
+        // @brief           - removes last array element
+        // @return          - last array element
+        T pop();
+
+        // @brief           - adds element to end of array. Never moves
+        //                    existing elements.
+        // @param val       - value of element
+        void push(T val);
+
+        // @brief           - constructs element in place at end of array
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - reference to new element
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
+
+        // @brief           - creates a new element at specified index,
+        //                    shifting other array els. Array size increases.
+        // @param val       - value of new element
+        // @param idx       - desired location of new element, 0 <= idx <= length
+        void insert(T val, std::size_t idx);
+
+        // @brief           - sets the value of some array element, without
+        //                    modifying other els. Array size unchanged.
+        // @param idx       - integer between 0 and array length - 1
+        // @param val       - value to set at that el
+        void set(T val, std::size_t idx);
+
+        // @brief           - finds first element equal to val, chunk by chunk
+        //                    with vectorised kernels for arithmetic T
+        // @param val       - value to search for
+        // @return          - index of first match, length if not found
+        std::size_t find(const T& val);
+
+        // @brief           - allocates chunks until num elements fit
+        // @param num       - number of slots to reserve. No-op if <= capacity.
+        void reserve(std::size_t num);
+
+        // @brief           - frees chunks past the last element
+        void shrink_to_fit();
+
+        // @brief           - frees up all allocated memory
+        void clear();
+};
+
+
+/*
+Define class - in hpp file due to template issues
+*/
+
+// @brief           - pointer to slot of some element, live or not
+// @param idx       - integer between 0 and capacity - 1
+template <typename T, std::size_t ChunkBits, typename Alloc>
+T* SegmentedArray<T,ChunkBits,Alloc>::slot(std::size_t idx) {
+    return this->chunks_[idx >> ChunkBits] + (idx & MASK);
+}
+
+// @brief           - allocates one more chunk of raw memory
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::add_chunk() {
+    T* p_chunk = AllocTraits::allocate(this->alloc_, CHUNK);
+    try {
+        this->chunks_.push(p_chunk);
+    } catch (...) {
+        AllocTraits::deallocate(this->alloc_, p_chunk, CHUNK);
+        throw;
+    }
+}
+
+// @brief           - creates new array with room for cap elements
+// @param cap       - number of elements to reserve, rounded up to
+//                    whole chunks. >0.
+// @param alloc     - allocator that provides all element memory
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>::SegmentedArray(std::size_t cap, const Alloc& alloc)
+    : alloc_(alloc), chunks_(1, ChunkAlloc(alloc)) {
+    // handle 0 capacity error
+    if (cap < 1) {
+        throw std::domain_error("Invalid input capacity: " + std::to_string(cap));
+    }
+
+    try {
+        this->reserve(cap);
+    } catch (...) {
+        // destructor won't run for a partially built array
+        this->clear();
+        throw;
+    }
+}
+
+// @brief           - creates new array filled with num copies of fill
+// @param num       - number of elements in array, >0.
+// @param fill      - value to copy into every element
+// @param alloc     - allocator that provides all element memory
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>::SegmentedArray(std::size_t num, const T& fill, const Alloc& alloc)
+    : SegmentedArray(num, alloc) {
+    // delegated constructor has finished, so destructor cleans up on exceptions
+    for (std::size_t i = 0; i < num; ++i) {
+        this->push(fill);
+    }
+}
+
+// @brief           - copies live elements of other array
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>::SegmentedArray(const SegmentedArray<T,ChunkBits,Alloc>& other)
+    : alloc_(AllocTraits::select_on_container_copy_construction(other.alloc_)),
+      chunks_(1, ChunkAlloc(this->alloc_)) {
+    // accessors aren't const, but other is only read
+    SegmentedArray<T,ChunkBits,Alloc>& src = const_cast<SegmentedArray<T,ChunkBits,Alloc>&>(other);
+    try {
+        this->reserve(src.size_);
+        for (std::size_t i = 0; i < src.size_; ++i) {
+            this->push(*src.slot(i));
+        }
+    } catch (...) {
+        // destructor won't run for a partially built copy
+        this->clear();
+        throw;
+    }
+}
+
+// @brief           - replaces elements with copies of other array's
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>& SegmentedArray<T,ChunkBits,Alloc>::operator=(
+    const SegmentedArray<T,ChunkBits,Alloc>& other
+) {
+    if (this != &other) {
+        // keep chunks, only live elements are replaced
+        while (this->size_) {
+            this->pop();
+        }
+        // accessors aren't const, but other is only read
+        SegmentedArray<T,ChunkBits,Alloc>& src = const_cast<SegmentedArray<T,ChunkBits,Alloc>&>(other);
+        this->reserve(src.size_);
+        for (std::size_t i = 0; i < src.size_; ++i) {
+            this->push(*src.slot(i));
+        }
+    }
+    return *this;
+}
+
+// @brief           - takes other array's chunks, leaving it empty
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>::SegmentedArray(SegmentedArray<T,ChunkBits,Alloc>&& other) noexcept
+    : alloc_(std::move(other.alloc_)), size_(other.size_), chunks_(std::move(other.chunks_)) {
+    other.size_ = 0;
+}
+
+// @brief           - takes other array's chunks, leaving it empty.
+//                    Moves elements one by one if allocators differ.
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>& SegmentedArray<T,ChunkBits,Alloc>::operator=(
+    SegmentedArray<T,ChunkBits,Alloc>&& other
+) {
+    if (this == &other) return *this;
+
+    constexpr bool propagate = AllocTraits::propagate_on_container_move_assignment::value;
+    this->clear();
+
+    // chunks can only change hands if this allocator can free them
+    if (propagate || AllocTraits::is_always_equal::value || this->alloc_ == other.alloc_) {
+        if constexpr (propagate) this->alloc_ = std::move(other.alloc_);
+        this->chunks_ = std::move(other.chunks_);
+        this->size_ = other.size_;
+        other.size_ = 0;
+    } else {
+        this->reserve(other.size_);
+        for (std::size_t i = 0; i < other.size_; ++i) {
+            this->push(std::move(*other.slot(i)));
+        }
+        other.clear();
+    }
+    return *this;
+}
+
+// @brief           - destroys live elements and frees all chunks
+template <typename T, std::size_t ChunkBits, typename Alloc>
+SegmentedArray<T,ChunkBits,Alloc>::~SegmentedArray() {
+    this->clear();
+}
+
+// @brief           - returns allocator providing element memory
+template <typename T, std::size_t ChunkBits, typename Alloc>
+Alloc SegmentedArray<T,ChunkBits,Alloc>::get_allocator() {
+    return this->alloc_;
+}
+
+// @brief           - returns number of reserved memory blocks
+template <typename T, std::size_t ChunkBits, typename Alloc>
+std::size_t SegmentedArray<T,ChunkBits,Alloc>::capacity() {
+    return this->chunks_.length() * CHUNK;
+}
+
+// @brief           - returns number of occupied memory blocks
+template <typename T, std::size_t ChunkBits, typename Alloc>
+std::size_t SegmentedArray<T,ChunkBits,Alloc>::length() {
+    return this->size_;
+}
+
+// @brief           - indexes some array element
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, std::size_t ChunkBits, typename Alloc>
+T& SegmentedArray<T,ChunkBits,Alloc>::at(std::size_t idx) {
+    if (idx >= this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    return *this->slot(idx);
+}
+
+// @brief           - indexes some array element, no bounds check
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, std::size_t ChunkBits, typename Alloc>
+T& SegmentedArray<T,ChunkBits,Alloc>::operator[](std::size_t idx) {
+    return *this->slot(idx);
+}
+
+// @brief           - removes last array element
+// @return          - last array element
+template <typename T, std::size_t ChunkBits, typename Alloc>
+T SegmentedArray<T,ChunkBits,Alloc>::pop() {
+    if (this->size_ == 0) {
+        throw std::range_error("No elements to pop");
+    }
+
+    T* p_last = this->slot(this->size_ - 1);
+    T el = std::move(*p_last);
+    // end element lifetime, chunk stays reserved
+    AllocTraits::destroy(this->alloc_, p_last);
+    --this->size_;
+    return el;
+}
+
+// @brief           - adds element to end of array. Never moves
+//                    existing elements.
+// @param val       - value of element
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::push(T val) {
+    if (this->size_ >= this->capacity()) {
+        this->add_chunk();
+    }
+
+    AllocTraits::construct(this->alloc_, this->slot(this->size_), std::move(val));
+    ++this->size_;
+}
+
+// @brief           - constructs element in place at end of array
+// @param args      - arguments forwarded to T's constructor
+// @return          - reference to new element
+template <typename T, std::size_t ChunkBits, typename Alloc>
+template <typename... Args>
+T& SegmentedArray<T,ChunkBits,Alloc>::emplace_back(Args&&... args) {
+    // new chunks never move old elements, so args stay valid
+    if (this->size_ >= this->capacity()) {
+        this->add_chunk();
+    }
+
+    T* p_slot = this->slot(this->size_);
+    AllocTraits::construct(this->alloc_, p_slot, std::forward<Args>(args)...);
+    ++this->size_;
+    return *p_slot;
+}
+
+// @brief           - creates a new element at specified index,
+//                    shifting other array els. Array size increases.
+// @param val       - value of new element
+// @param idx       - desired location of new element, 0 <= idx <= length
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::insert(T val, std::size_t idx) {
+    if (idx > this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    if (idx == this->size_) {
+        this->push(std::move(val));
+        return;
+    }
+
+    // last element moves into a new slot, the rest shift up one across chunks
+    this->push(std::move(*this->slot(this->size_ - 1)));
+    for (std::size_t i = this->size_ - 2; i > idx; --i) {
+        *this->slot(i) = std::move(*this->slot(i - 1));
+    }
+    *this->slot(idx) = std::move(val);
+}
+
+// @brief           - sets the value of some array element, without
+//                    modifying other els. Array size unchanged.
+// @param idx       - integer between 0 and array length - 1
+// @param val       - value to set at that el
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::set(T val, std::size_t idx) {
+    if (idx >= this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    *this->slot(idx) = std::move(val);
+}
+
+// @brief           - finds first element equal to val, chunk by chunk
+//                    with vectorised kernels for arithmetic T
+// @param val       - value to search for
+// @return          - index of first match, length if not found
+template <typename T, std::size_t ChunkBits, typename Alloc>
+std::size_t SegmentedArray<T,ChunkBits,Alloc>::find(const T& val) {
+    for (std::size_t start = 0; start < this->size_; start += CHUNK) {
+        std::size_t num = (this->size_ - start < CHUNK) ? this->size_ - start : CHUNK;
+        std::size_t idx = SimdKernels::find(this->slot(start), num, val);
+        if (idx < num) return start + idx;
+    }
+    return this->size_;
+}
+
+// @brief           - allocates chunks until num elements fit
+// @param num       - number of slots to reserve. No-op if <= capacity.
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::reserve(std::size_t num) {
+    std::size_t num_chunks = (num + MASK) >> ChunkBits;
+    this->chunks_.reserve(num_chunks);
+    while (this->chunks_.length() < num_chunks) {
+        this->add_chunk();
+    }
+}
+
+// @brief           - frees chunks past the last element
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::shrink_to_fit() {
+    std::size_t num_chunks = (this->size_ + MASK) >> ChunkBits;
+    while (this->chunks_.length() > num_chunks) {
+        AllocTraits::deallocate(this->alloc_, this->chunks_.pop(), CHUNK);
+    }
+}
+
+// @brief           - frees up all allocated memory
+template <typename T, std::size_t ChunkBits, typename Alloc>
+void SegmentedArray<T,ChunkBits,Alloc>::clear() {
+    // only live elements were ever constructed
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (std::size_t i = 0; i < this->size_; ++i) {
+            AllocTraits::destroy(this->alloc_, this->slot(i));
+        }
+    }
+    this->size_ = 0;
+    this->shrink_to_fit();
+}
+
+#endif
@@ -0,0 +1,90 @@
+// @file         - SegmentedArrayTest.cpp
+// @brief        - Testing a chunked dynamic array and binary heaps stored in it
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// =============================================================================
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "./SegmentedArray.hpp"
+#include "../binaryheap/BinaryHeap.hpp"
+
+int main() {
+    // 4 elements per chunk, so small tests cross chunk boundaries
+    SegmentedArray<int, 2> a_test(1);
+
+    // Getter methods
+    std::cout << "Initialised elements: " + std::to_string(a_test.length()) << std::endl;
+    std::cout << "Reserved blocks: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // addresses stay stable while growing
+    a_test.push(0);
+    int* p_first = &a_test.at(0);
+    for (int i = 1; i < 19; ++i) {
+        a_test.push(i);
+    }
+    std::cout << "Size after pushes: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+    std::cout << "First element not moved: " << (p_first == &a_test.at(0)) << std::endl;
+
+    // insert shifts across chunks
+    a_test.insert(100, 2);
+    a_test.set(200, 0);
+    std::cout << "Elements: ";
+    for (std::size_t i = 0; i < a_test.length(); ++i) {
+        std::cout << a_test.at(i) << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "Find 17: " << a_test.find(17);
+    std::cout << ", find missing: " << a_test.find(-1) << std::endl;
+    std::cout << "Popped: " + std::to_string(a_test.pop()) << std::endl;
+
+    // out of range index
+    try {
+        a_test.at(19);
+    } catch (const std::range_error& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    // copies and non trivial elements
+    SegmentedArray<std::string, 1> s_test(1);
+    s_test.push("b");
+    s_test.push("c");
+    s_test.insert("a", 0);
+    SegmentedArray<std::string, 1> s_copy = s_test;
+    s_test.set("z", 0);
+    std::cout << "Copied strings: ";
+    for (std::size_t i = 0; i < s_copy.length(); ++i) {
+        std::cout << s_copy.at(i) << " ";
+    }
+    std::cout << std::endl;
+
+    // frees chunks past the last element
+    for (int i = 0; i < 10; ++i) {
+        a_test.pop();
+    }
+    a_test.shrink_to_fit();
+    std::cout << "Shrunk: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+    a_test.clear();
+    std::cout << "Cleared: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // binary heap backed by chunks
+    BinaryHeap<int, std::allocator<int>, DoublingGrowth, SegmentedArray<int, 2>> heap;
+    for (int val : {5, 3, 9, 1, 7, 8, 2, 6, 4, 9}) {
+        heap.push(val);
+    }
+    heap.remove_by_value(9, true);
+    std::cout << "Segmented heap polls: ";
+    while (heap.count()) {
+        std::cout << heap.poll() << " ";
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
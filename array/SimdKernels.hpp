@@ -0,0 +1,814 @@
+// @file         - SimdKernels.hpp
+// @brief        - Defining vectorised search and reduction kernels over
+//                 contiguous int/float/double arrays, e.g. DynamicArray::data()
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - AVX2 and SSE4.2 versions are picked at runtime from the
+//                 CPU's features. Other CPUs, compilers and element types use
+//                 the scalar versions, so any T with == and < works.
+// =============================================================================
+
+#ifndef SIMDKERNELS_HPP
+#define SIMDKERNELS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMDKERNELS_X86
+#include <immintrin.h>
+#endif
+
+/*
+Declare class
+*/
+
+// @brief           - type sums are accumulated and returned in. Wider than T
+//                    for int and float so large arrays don't overflow/round off.
+template <typename T> struct SimdSum { using type = T; };
+template <> struct SimdSum<int> { using type = long long; };
+template <> struct SimdSum<float> { using type = double; };
+
+class SimdKernels {
+    private:
+        // instruction sets in order of preference
+        enum Level { SCALAR = 0, SSE42 = 1, AVX2 = 2 };
+
+        // vectors counted before 32 bit lane counters are added to a 64 bit
+        // total. Each lane gains at most one per vector, so they can't wrap.
+        static constexpr std::size_t COUNT_FLUSH = std::size_t{1} << 31;
+
+        // @brief           - detects the best instruction set once per process
+        // @return          - best Level supported by the CPU
+        static int level();
+
+        // @brief           - true for element types with vector versions
+        template <typename T>
+        static constexpr bool vectorised() {
+            return std::is_same<T, int>::value || std::is_same<T, float>::value ||
+                   std::is_same<T, double>::value;
+        }
+
+        // scalar versions, also used for the tail of each vector loop
+        template <typename T>
+        static std::size_t find_scalar(const T* p_vals, std::size_t num, const T& val);
+        template <typename T>
+        static std::size_t count_scalar(const T* p_vals, std::size_t num, const T& val);
+        template <typename T>
+        static T min_scalar(const T* p_vals, std::size_t num);
+        template <typename T>
+        static T max_scalar(const T* p_vals, std::size_t num);
+        template <typename T>
+        static typename SimdSum<T>::type sum_scalar(const T* p_vals, std::size_t num);
+
+#ifdef SIMDKERNELS_X86
+        // AVX2 versions, 256 bit lanes
+        static std::size_t find_avx2(const int* p_vals, std::size_t num, int val);
+        static std::size_t find_avx2(const float* p_vals, std::size_t num, float val);
+        static std::size_t find_avx2(const double* p_vals, std::size_t num, double val);
+        static std::size_t count_avx2(const int* p_vals, std::size_t num, int val);
+        static std::size_t count_avx2(const float* p_vals, std::size_t num, float val);
+        static std::size_t count_avx2(const double* p_vals, std::size_t num, double val);
+        static int min_avx2(const int* p_vals, std::size_t num);
+        static float min_avx2(const float* p_vals, std::size_t num);
+        static double min_avx2(const double* p_vals, std::size_t num);
+        static int max_avx2(const int* p_vals, std::size_t num);
+        static float max_avx2(const float* p_vals, std::size_t num);
+        static double max_avx2(const double* p_vals, std::size_t num);
+        static long long sum_avx2(const int* p_vals, std::size_t num);
+        static double sum_avx2(const float* p_vals, std::size_t num);
+        static double sum_avx2(const double* p_vals, std::size_t num);
+
+        // SSE4.2 versions, 128 bit lanes
+        static std::size_t find_sse42(const int* p_vals, std::size_t num, int val);
+        static std::size_t find_sse42(const float* p_vals, std::size_t num, float val);
+        static std::size_t find_sse42(const double* p_vals, std::size_t num, double val);
+        static std::size_t count_sse42(const int* p_vals, std::size_t num, int val);
+        static std::size_t count_sse42(const float* p_vals, std::size_t num, float val);
+        static std::size_t count_sse42(const double* p_vals, std::size_t num, double val);
+        static int min_sse42(const int* p_vals, std::size_t num);
+        static float min_sse42(const float* p_vals, std::size_t num);
+        static double min_sse42(const double* p_vals, std::size_t num);
+        static int max_sse42(const int* p_vals, std::size_t num);
+        static float max_sse42(const float* p_vals, std::size_t num);
+        static double max_sse42(const double* p_vals, std::size_t num);
+        static long long sum_sse42(const int* p_vals, std::size_t num);
+        static double sum_sse42(const float* p_vals, std::size_t num);
+        static double sum_sse42(const double* p_vals, std::size_t num);
+#endif
+
+    public:
+        // @brief           - finds first element equal to val
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements
+        // @param val       - value to search for
+        // @return          - index of first match, num if not found
+        template <typename T>
+        static std::size_t find(const T* p_vals, std::size_t num, const T& val);
+
+        // @brief           - counts elements equal to val
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements
+        // @param val       - value to count
+        // @return          - number of matches
+        template <typename T>
+        static std::size_t count(const T* p_vals, std::size_t num, const T& val);
+
+        // @brief           - finds smallest element. Order of NaNs unspecified.
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements, >0
+        // @return          - smallest element
+        template <typename T>
+        static T min(const T* p_vals, std::size_t num);
+
+        // @brief           - finds largest element. Order of NaNs unspecified.
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements, >0
+        // @return          - largest element
+        template <typename T>
+        static T max(const T* p_vals, std::size_t num);
+
+        // @brief           - adds all elements. Floating point sums are added
+        //                    lane by lane, so may round differently to a loop.
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements
+        // @return          - sum, widened per SimdSum
+        template <typename T>
+        static typename SimdSum<T>::type sum(const T* p_vals, std::size_t num);
+
+        // @brief           - checks if any element equals any of a set of keys
+        // @param p_vals    - pointer to first element
+        // @param num       - number of elements
+        // @param p_keys    - pointer to first key
+        // @param num_keys  - number of keys. Best for small sets.
+        // @return          - true if some element matches some key
+        template <typename T>
+        static bool contains_any(const T* p_vals, std::size_t num,
+                                 const T* p_keys, std::size_t num_keys);
+};
+
+
+/*
+Define class - in hpp file due to template issues
+*/
+
+// @brief           - detects the best instruction set once per process
+// @return          - best Level supported by the CPU
+inline int SimdKernels::level() {
+#ifdef SIMDKERNELS_X86
+    static const int detected = (__builtin_cpu_supports("avx2")) ? AVX2 :
+                                (__builtin_cpu_supports("sse4.2")) ? SSE42 : SCALAR;
+    return detected;
+#else
+    return SCALAR;
+#endif
+}
+
+
+/*
+Scalar versions
+*/
+
+template <typename T>
+std::size_t SimdKernels::find_scalar(const T* p_vals, std::size_t num, const T& val) {
+    for (std::size_t i = 0; i < num; ++i) {
+        if (p_vals[i] == val) return i;
+    }
+    return num;
+}
+
+template <typename T>
+std::size_t SimdKernels::count_scalar(const T* p_vals, std::size_t num, const T& val) {
+    std::size_t total{0};
+    for (std::size_t i = 0; i < num; ++i) {
+        total += (p_vals[i] == val);
+    }
+    return total;
+}
+
+template <typename T>
+T SimdKernels::min_scalar(const T* p_vals, std::size_t num) {
+    T best = p_vals[0];
+    for (std::size_t i = 1; i < num; ++i) {
+        if (p_vals[i] < best) best = p_vals[i];
+    }
+    return best;
+}
+
+template <typename T>
+T SimdKernels::max_scalar(const T* p_vals, std::size_t num) {
+    T best = p_vals[0];
+    for (std::size_t i = 1; i < num; ++i) {
+        if (best < p_vals[i]) best = p_vals[i];
+    }
+    return best;
+}
+
+template <typename T>
+typename SimdSum<T>::type SimdKernels::sum_scalar(const T* p_vals, std::size_t num) {
+    typename SimdSum<T>::type total{};
+    for (std::size_t i = 0; i < num; ++i) {
+        total += p_vals[i];
+    }
+    return total;
+}
+
+
+#ifdef SIMDKERNELS_X86
+/*
+AVX2 versions. Each handles whole vectors, then hands the tail to scalar.
+*/
+
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::find_avx2(const int* p_vals, std::size_t num, int val) {
+    const __m256i key = _mm256_set1_epi32(val);
+    std::size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::find_avx2(const float* p_vals, std::size_t num, float val) {
+    const __m256 key = _mm256_set1_ps(val);
+    std::size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256 v = _mm256_loadu_ps(p_vals + i);
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(v, key, _CMP_EQ_OQ));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::find_avx2(const double* p_vals, std::size_t num, double val) {
+    const __m256d key = _mm256_set1_pd(val);
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m256d v = _mm256_loadu_pd(p_vals + i);
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(v, key, _CMP_EQ_OQ));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+// lane counters are 32 bit, so they're flushed every COUNT_FLUSH vectors
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::count_avx2(const int* p_vals, std::size_t num, int val) {
+    const __m256i key = _mm256_set1_epi32(val);
+    std::size_t total{0};
+    std::size_t i = 0;
+    while (i + 8 <= num) {
+        std::size_t stop = i + std::min((num - i) / 8, COUNT_FLUSH) * 8;
+        __m256i acc = _mm256_setzero_si256();
+        for (; i < stop; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals + i));
+            acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, key)); // match is -1
+        }
+
+        alignas(32) unsigned int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (unsigned int lane : lanes) total += lane;
+    }
+    return total + count_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::count_avx2(const float* p_vals, std::size_t num, float val) {
+    const __m256 key = _mm256_set1_ps(val);
+    std::size_t total{0};
+    std::size_t i = 0;
+    while (i + 8 <= num) {
+        std::size_t stop = i + std::min((num - i) / 8, COUNT_FLUSH) * 8;
+        __m256i acc = _mm256_setzero_si256();
+        for (; i < stop; i += 8) {
+            __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(p_vals + i), key, _CMP_EQ_OQ);
+            acc = _mm256_sub_epi32(acc, _mm256_castps_si256(eq));
+        }
+
+        alignas(32) unsigned int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (unsigned int lane : lanes) total += lane;
+    }
+    return total + count_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("avx2")))
+inline std::size_t SimdKernels::count_avx2(const double* p_vals, std::size_t num, double val) {
+    const __m256d key = _mm256_set1_pd(val);
+    __m256i acc = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m256d eq = _mm256_cmp_pd(_mm256_loadu_pd(p_vals + i), key, _CMP_EQ_OQ);
+        acc = _mm256_sub_epi64(acc, _mm256_castpd_si256(eq));
+    }
+
+    alignas(32) unsigned long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    std::size_t total = count_scalar(p_vals + i, num - i, val);
+    for (unsigned long long lane : lanes) total += lane;
+    return total;
+}
+
+__attribute__((target("avx2")))
+inline int SimdKernels::min_avx2(const int* p_vals, std::size_t num) {
+    if (num < 8) return min_scalar(p_vals, num);
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals));
+    std::size_t i = 8;
+    for (; i + 8 <= num; i += 8) {
+        acc = _mm256_min_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals + i)));
+    }
+
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int best = min_scalar(lanes, 8);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline float SimdKernels::min_avx2(const float* p_vals, std::size_t num) {
+    if (num < 8) return min_scalar(p_vals, num);
+    __m256 acc = _mm256_loadu_ps(p_vals);
+    std::size_t i = 8;
+    for (; i + 8 <= num; i += 8) {
+        acc = _mm256_min_ps(acc, _mm256_loadu_ps(p_vals + i));
+    }
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, acc);
+    float best = min_scalar(lanes, 8);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline double SimdKernels::min_avx2(const double* p_vals, std::size_t num) {
+    if (num < 4) return min_scalar(p_vals, num);
+    __m256d acc = _mm256_loadu_pd(p_vals);
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm256_min_pd(acc, _mm256_loadu_pd(p_vals + i));
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double best = min_scalar(lanes, 4);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline int SimdKernels::max_avx2(const int* p_vals, std::size_t num) {
+    if (num < 8) return max_scalar(p_vals, num);
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals));
+    std::size_t i = 8;
+    for (; i + 8 <= num; i += 8) {
+        acc = _mm256_max_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals + i)));
+    }
+
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    int best = max_scalar(lanes, 8);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline float SimdKernels::max_avx2(const float* p_vals, std::size_t num) {
+    if (num < 8) return max_scalar(p_vals, num);
+    __m256 acc = _mm256_loadu_ps(p_vals);
+    std::size_t i = 8;
+    for (; i + 8 <= num; i += 8) {
+        acc = _mm256_max_ps(acc, _mm256_loadu_ps(p_vals + i));
+    }
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, acc);
+    float best = max_scalar(lanes, 8);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline double SimdKernels::max_avx2(const double* p_vals, std::size_t num) {
+    if (num < 4) return max_scalar(p_vals, num);
+    __m256d acc = _mm256_loadu_pd(p_vals);
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm256_max_pd(acc, _mm256_loadu_pd(p_vals + i));
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double best = max_scalar(lanes, 4);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("avx2")))
+inline long long SimdKernels::sum_avx2(const int* p_vals, std::size_t num) {
+    __m256i acc = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_vals + i));
+        // widen both halves to 64 bit lanes before adding
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+
+    alignas(32) long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(p_vals + i, num - i);
+}
+
+__attribute__((target("avx2")))
+inline double SimdKernels::sum_avx2(const float* p_vals, std::size_t num) {
+    __m256d acc = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        __m256 v = _mm256_loadu_ps(p_vals + i);
+        // widen both halves to double lanes before adding
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        acc = _mm256_add_pd(acc, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(p_vals + i, num - i);
+}
+
+__attribute__((target("avx2")))
+inline double SimdKernels::sum_avx2(const double* p_vals, std::size_t num) {
+    __m256d acc = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm256_add_pd(acc, _mm256_loadu_pd(p_vals + i));
+    }
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(p_vals + i, num - i);
+}
+
+
+/*
+SSE4.2 versions. Each handles whole vectors, then hands the tail to scalar.
+*/
+
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::find_sse42(const int* p_vals, std::size_t num, int val) {
+    const __m128i key = _mm_set1_epi32(val);
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, key)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::find_sse42(const float* p_vals, std::size_t num, float val) {
+    const __m128 key = _mm_set1_ps(val);
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p_vals + i), key));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::find_sse42(const double* p_vals, std::size_t num, double val) {
+    const __m128d key = _mm_set1_pd(val);
+    std::size_t i = 0;
+    for (; i + 2 <= num; i += 2) {
+        int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p_vals + i), key));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i + find_scalar(p_vals + i, num - i, val);
+}
+
+// lane counters are 32 bit, so they're flushed every COUNT_FLUSH vectors
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::count_sse42(const int* p_vals, std::size_t num, int val) {
+    const __m128i key = _mm_set1_epi32(val);
+    std::size_t total{0};
+    std::size_t i = 0;
+    while (i + 4 <= num) {
+        std::size_t stop = i + std::min((num - i) / 4, COUNT_FLUSH) * 4;
+        __m128i acc = _mm_setzero_si128();
+        for (; i < stop; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals + i));
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, key)); // match is -1
+        }
+
+        alignas(16) unsigned int lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        for (unsigned int lane : lanes) total += lane;
+    }
+    return total + count_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::count_sse42(const float* p_vals, std::size_t num, float val) {
+    const __m128 key = _mm_set1_ps(val);
+    std::size_t total{0};
+    std::size_t i = 0;
+    while (i + 4 <= num) {
+        std::size_t stop = i + std::min((num - i) / 4, COUNT_FLUSH) * 4;
+        __m128i acc = _mm_setzero_si128();
+        for (; i < stop; i += 4) {
+            __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(p_vals + i), key);
+            acc = _mm_sub_epi32(acc, _mm_castps_si128(eq));
+        }
+
+        alignas(16) unsigned int lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        for (unsigned int lane : lanes) total += lane;
+    }
+    return total + count_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("sse4.2")))
+inline std::size_t SimdKernels::count_sse42(const double* p_vals, std::size_t num, double val) {
+    const __m128d key = _mm_set1_pd(val);
+    __m128i acc = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 2 <= num; i += 2) {
+        __m128d eq = _mm_cmpeq_pd(_mm_loadu_pd(p_vals + i), key);
+        acc = _mm_sub_epi64(acc, _mm_castpd_si128(eq));
+    }
+
+    alignas(16) unsigned long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + count_scalar(p_vals + i, num - i, val);
+}
+
+__attribute__((target("sse4.2")))
+inline int SimdKernels::min_sse42(const int* p_vals, std::size_t num) {
+    if (num < 4) return min_scalar(p_vals, num);
+    __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals));
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm_min_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals + i)));
+    }
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    int best = min_scalar(lanes, 4);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline float SimdKernels::min_sse42(const float* p_vals, std::size_t num) {
+    if (num < 4) return min_scalar(p_vals, num);
+    __m128 acc = _mm_loadu_ps(p_vals);
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm_min_ps(acc, _mm_loadu_ps(p_vals + i));
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    float best = min_scalar(lanes, 4);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline double SimdKernels::min_sse42(const double* p_vals, std::size_t num) {
+    if (num < 2) return min_scalar(p_vals, num);
+    __m128d acc = _mm_loadu_pd(p_vals);
+    std::size_t i = 2;
+    for (; i + 2 <= num; i += 2) {
+        acc = _mm_min_pd(acc, _mm_loadu_pd(p_vals + i));
+    }
+
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    double best = min_scalar(lanes, 2);
+    if (i < num) best = std::min(best, min_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline int SimdKernels::max_sse42(const int* p_vals, std::size_t num) {
+    if (num < 4) return max_scalar(p_vals, num);
+    __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals));
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm_max_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals + i)));
+    }
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    int best = max_scalar(lanes, 4);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline float SimdKernels::max_sse42(const float* p_vals, std::size_t num) {
+    if (num < 4) return max_scalar(p_vals, num);
+    __m128 acc = _mm_loadu_ps(p_vals);
+    std::size_t i = 4;
+    for (; i + 4 <= num; i += 4) {
+        acc = _mm_max_ps(acc, _mm_loadu_ps(p_vals + i));
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    float best = max_scalar(lanes, 4);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline double SimdKernels::max_sse42(const double* p_vals, std::size_t num) {
+    if (num < 2) return max_scalar(p_vals, num);
+    __m128d acc = _mm_loadu_pd(p_vals);
+    std::size_t i = 2;
+    for (; i + 2 <= num; i += 2) {
+        acc = _mm_max_pd(acc, _mm_loadu_pd(p_vals + i));
+    }
+
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    double best = max_scalar(lanes, 2);
+    if (i < num) best = std::max(best, max_scalar(p_vals + i, num - i));
+    return best;
+}
+
+__attribute__((target("sse4.2")))
+inline long long SimdKernels::sum_sse42(const int* p_vals, std::size_t num) {
+    __m128i acc = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_vals + i));
+        // widen both halves to 64 bit lanes before adding
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_unpackhi_epi64(v, v)));
+    }
+
+    alignas(16) long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + sum_scalar(p_vals + i, num - i);
+}
+
+__attribute__((target("sse4.2")))
+inline double SimdKernels::sum_sse42(const float* p_vals, std::size_t num) {
+    __m128d acc = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        __m128 v = _mm_loadu_ps(p_vals + i);
+        // widen both halves to double lanes before adding
+        acc = _mm_add_pd(acc, _mm_cvtps_pd(v));
+        acc = _mm_add_pd(acc, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    return lanes[0] + lanes[1] + sum_scalar(p_vals + i, num - i);
+}
+
+__attribute__((target("sse4.2")))
+inline double SimdKernels::sum_sse42(const double* p_vals, std::size_t num) {
+    __m128d acc = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 2 <= num; i += 2) {
+        acc = _mm_add_pd(acc, _mm_loadu_pd(p_vals + i));
+    }
+
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    return lanes[0] + lanes[1] + sum_scalar(p_vals + i, num - i);
+}
+#endif
+
+
+/*
+Public kernels, dispatch to best version for T and CPU
+*/
+
+// @brief           - finds first element equal to val
+// @param p_vals    - pointer to first element
+// @param num       - number of elements
+// @param val       - value to search for
+// @return          - index of first match, num if not found
+template <typename T>
+std::size_t SimdKernels::find(const T* p_vals, std::size_t num, const T& val) {
+#ifdef SIMDKERNELS_X86
+    if constexpr (SimdKernels::vectorised<T>()) {
+        switch (SimdKernels::level()) {
+            case AVX2: return find_avx2(p_vals, num, val);
+            case SSE42: return find_sse42(p_vals, num, val);
+        }
+    }
+#endif
+    return find_scalar(p_vals, num, val);
+}
+
+// @brief           - counts elements equal to val
+// @param p_vals    - pointer to first element
+// @param num       - number of elements
+// @param val       - value to count
+// @return          - number of matches
+template <typename T>
+std::size_t SimdKernels::count(const T* p_vals, std::size_t num, const T& val) {
+#ifdef SIMDKERNELS_X86
+    if constexpr (SimdKernels::vectorised<T>()) {
+        switch (SimdKernels::level()) {
+            case AVX2: return count_avx2(p_vals, num, val);
+            case SSE42: return count_sse42(p_vals, num, val);
+        }
+    }
+#endif
+    return count_scalar(p_vals, num, val);
+}
+
+// @brief           - finds smallest element. Order of NaNs unspecified.
+// @param p_vals    - pointer to first element
+// @param num       - number of elements, >0
+// @return          - smallest element
+template <typename T>
+T SimdKernels::min(const T* p_vals, std::size_t num) {
+    if (num == 0) {
+        throw std::range_error("No elements to find min of");
+    }
+
+#ifdef SIMDKERNELS_X86
+    if constexpr (SimdKernels::vectorised<T>()) {
+        switch (SimdKernels::level()) {
+            case AVX2: return min_avx2(p_vals, num);
+            case SSE42: return min_sse42(p_vals, num);
+        }
+    }
+#endif
+    return min_scalar(p_vals, num);
+}
+
+// @brief           - finds largest element. Order of NaNs unspecified.
+// @param p_vals    - pointer to first element
+// @param num       - number of elements, >0
+// @return          - largest element
+template <typename T>
+T SimdKernels::max(const T* p_vals, std::size_t num) {
+    if (num == 0) {
+        throw std::range_error("No elements to find max of");
+    }
+
+#ifdef SIMDKERNELS_X86
+    if constexpr (SimdKernels::vectorised<T>()) {
+        switch (SimdKernels::level()) {
+            case AVX2: return max_avx2(p_vals, num);
+            case SSE42: return max_sse42(p_vals, num);
+        }
+    }
+#endif
+    return max_scalar(p_vals, num);
+}
+
+// @brief           - adds all elements. Floating point sums are added
+//                    lane by lane, so may round differently to a loop.
+// @param p_vals    - pointer to first element
+// @param num       - number of elements
+// @return          - sum, widened per SimdSum
+template <typename T>
+typename SimdSum<T>::type SimdKernels::sum(const T* p_vals, std::size_t num) {
+#ifdef SIMDKERNELS_X86
+    if constexpr (SimdKernels::vectorised<T>()) {
+        switch (SimdKernels::level()) {
+            case AVX2: return sum_avx2(p_vals, num);
+            case SSE42: return sum_sse42(p_vals, num);
+        }
+    }
+#endif
+    return sum_scalar(p_vals, num);
+}
+
+// @brief           - checks if any element equals any of a set of keys
+// @param p_vals    - pointer to first element
+// @param num       - number of elements
+// @param p_keys    - pointer to first key
+// @param num_keys  - number of keys. Best for small sets.
+// @return          - true if some element matches some key
+template <typename T>
+bool SimdKernels::contains_any(const T* p_vals, std::size_t num,
+                               const T* p_keys, std::size_t num_keys) {
+    // one vectorised pass per key, each exits on its first match
+    for (std::size_t k = 0; k < num_keys; ++k) {
+        if (SimdKernels::find(p_vals, num, p_keys[k]) < num) return true;
+    }
+    return false;
+}
+
+#endif
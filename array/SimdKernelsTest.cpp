@@ -0,0 +1,102 @@
+// @file         - SimdKernelsTest.cpp
+// @brief        - Testing vectorised search and reduction kernels against
+//                 scalar loops, including lengths that leave partial vectors
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// =============================================================================
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "./DynamicArray.hpp"
+#include "./SimdKernels.hpp"
+
+// @brief           - checks every kernel against a scalar loop for one length
+// @param num       - number of elements
+// @return          - true if all kernels agree with the scalar loop
+template <typename T>
+bool check_length(std::size_t num) {
+    DynamicArray<T> arr(num + 1);
+    for (std::size_t i = 0; i < num; ++i) {
+        // repeats values, with one large and one small outlier
+        arr.push(T((i * 7) % 13) - T(6));
+    }
+    if (num > 2) {
+        arr[num / 2] = T(100);
+        arr[num - 1] = T(-100);
+    }
+
+    bool ok = true;
+    for (T val : {T(0), T(5), T(100), T(-100), T(42)}) {
+        std::size_t idx = num, matches = 0;
+        for (std::size_t i = 0; i < num; ++i) {
+            if (arr[i] == val) {
+                if (idx == num) idx = i;
+                ++matches;
+            }
+        }
+        ok = ok && SimdKernels::find(arr.data(), num, val) == idx;
+        ok = ok && SimdKernels::count(arr.data(), num, val) == matches;
+    }
+
+    if (num > 0) {
+        T lo = arr[0], hi = arr[0];
+        typename SimdSum<T>::type total{};
+        for (std::size_t i = 0; i < num; ++i) {
+            lo = (arr[i] < lo) ? arr[i] : lo;
+            hi = (hi < arr[i]) ? arr[i] : hi;
+            total += arr[i];
+        }
+        ok = ok && SimdKernels::min(arr.data(), num) == lo;
+        ok = ok && SimdKernels::max(arr.data(), num) == hi;
+        // small whole numbers, so floating point sums are exact too
+        ok = ok && SimdKernels::sum(arr.data(), num) == total;
+    }
+
+    T present[] = {T(42), T(-100)};
+    T absent[] = {T(42), T(43)};
+    ok = ok && SimdKernels::contains_any(arr.data(), num, present, 2) == (num > 2);
+    ok = ok && !SimdKernels::contains_any(arr.data(), num, absent, 2);
+    return ok;
+}
+
+// @brief           - checks all lengths up to and around a few vector widths
+// @param name      - label of element type
+template <typename T>
+void check_type(const std::string& name) {
+    bool ok = true;
+    for (std::size_t num = 0; num < 40; ++num) {
+        ok = ok && check_length<T>(num);
+    }
+    ok = ok && check_length<T>(1000) && check_length<T>(1027);
+    std::cout << name << " kernels match scalar: " << ok << std::endl;
+}
+
+int main() {
+    check_type<int>("int");
+    check_type<float>("float");
+    check_type<double>("double");
+    check_type<long long>("long long (scalar fallback)");
+
+    // sums are widened so large arrays don't overflow
+    DynamicArray<int> big(1000, 2000000000);
+    std::cout << "Widened int sum: " << SimdKernels::sum(big.data(), big.length()) << std::endl;
+
+    // strings compile too, through the scalar versions
+    DynamicArray<std::string> words(3);
+    words.push("a");
+    words.push("b");
+    words.push("c");
+    std::cout << "Find string: " << SimdKernels::find(words.data(), words.length(), std::string("c"));
+    std::cout << ", max string: " << SimdKernels::max(words.data(), words.length()) << std::endl;
+
+    // empty arrays have no min
+    try {
+        SimdKernels::min(big.data(), 0);
+    } catch (const std::range_error& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,362 @@
+// @file         - SmallDynamicArray.hpp
+// @brief        - Declaring a dynamic array that stores its first N elements
+//                 inline and only allocates once it outgrows them
+// @author       - Madhav Malhotra
+// @date         - 2023-12-24
+// @version      - 0.0.0
+// =============================================================================
+
+#ifndef SMALLDYNAMICARRAY_H
+#define SMALLDYNAMICARRAY_H
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/*
+Declare class
+*/
+
+template <typename T, std::size_t N = 16, typename Alloc = std::allocator<T>>
+class SmallDynamicArray {
+    static_assert(N > 0, "SmallDynamicArray requires an inline capacity of 1+");
+
+    private:
+        using AllocTraits = std::allocator_traits<Alloc>;
+
+        Alloc alloc_{};
+        std::size_t capacity_{N};
+        std::size_t size_{};
+        T* p_start_{};
+        alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+        // @brief           - first slot of the inline buffer
+        T* inline_start();
+
+        // @brief           - true until elements spill to the heap
+        bool is_inline();
+
+        // @brief           - moves live elements into a new heap block
+        // @param cap       - number of slots in new block, > N
+        void reallocate(std::size_t cap);
+
+        // @brief           - constructs elements from a range into raw memory.
+        //                    Already built elements are destroyed on exceptions.
+        // @param first     - iterator to first source element
+        // @param last      - iterator past last source element
+        // @param p_dest    - first raw memory slot to construct into
+        template <typename It>
+        void construct_range(It first, It last, T* p_dest);
+
+        // @brief           - destroys live elements, memory stays reserved
+        // @param p_first   - first element to destroy
+        // @param p_last    - element past last one to destroy
+        void destroy(T* p_first, T* p_last);
+
+    public:
+        // @brief           - creates empty array using the inline buffer
+        // @param alloc     - allocator used once elements spill to the heap
+        SmallDynamicArray(const Alloc& alloc = Alloc{});
+
+        // @brief           - copies live elements of other array
+        SmallDynamicArray(const SmallDynamicArray<T,N,Alloc>& other);
+
+        // @brief           - replaces elements with copies of other array's
+        SmallDynamicArray<T,N,Alloc>& operator=(const SmallDynamicArray<T,N,Alloc>& other);
+
+        // @brief           - destroys live elements and frees heap memory
+        ~SmallDynamicArray();
+
+        // @brief           - returns number of reserved memory blocks
+        std::size_t capacity();
+
+        // @brief           - returns number of occupied memory blocks
+        std::size_t length();
+
+        // @brief           - indexes some array element
+        // @param idx       - integer between 0 and array length - 1
+        // @return          - reference to array element selected
+        T& at(std::size_t idx);
+
+        // @brief           - removes last array element
+        // @return          - last array element
+        T pop();
+
+        // @brief           - adds element to end of array
+        // @param val       - value of element
+        void push(T val);
+
+        // @brief           - creates a new element at specified index,
+        //                    shifting other array els. Array size increases.
+        // @param val       - value of new element
+        // @param idx       - desired location of new element, 0 <= idx <= length
+        void insert(T val, std::size_t idx);
+
+        // @brief           - sets the value of some array element, without
+        //                    modifying other els. Array size unchanged.
+        // @param idx       - integer between 0 and array length - 1
+        // @param val       - value to set at that el
+        void set(T val, std::size_t idx);
+
+        // @brief           - increases allocated memory by 2x
+        void double_capacity();
+
+        // @brief           - deletes all elements, returns to the inline buffer
+        void clear();
+};
+
+
+/*
+Define class
+*/
+
+// @brief           - first slot of the inline buffer
+template <typename T, std::size_t N, typename Alloc>
+T* SmallDynamicArray<T,N,Alloc>::inline_start() {
+    return reinterpret_cast<T*>(this->buffer_);
+}
+
+// @brief           - true until elements spill to the heap
+template <typename T, std::size_t N, typename Alloc>
+bool SmallDynamicArray<T,N,Alloc>::is_inline() {
+    return this->p_start_ == this->inline_start();
+}
+
+// @brief           - moves live elements into a new heap block
+// @param cap       - number of slots in new block, > N
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::reallocate(std::size_t cap) {
+    T* p_start_new = AllocTraits::allocate(this->alloc_, cap);
+
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (this->size_) {
+            std::memcpy(p_start_new, this->p_start_, this->size_ * sizeof(T));
+        }
+    } else {
+        try {
+            this->construct_range(std::make_move_iterator(this->p_start_),
+                                  std::make_move_iterator(this->p_start_ + this->size_),
+                                  p_start_new);
+        } catch (...) {
+            AllocTraits::deallocate(this->alloc_, p_start_new, cap);
+            throw;
+        }
+        this->destroy(this->p_start_, this->p_start_ + this->size_);
+    }
+
+    // inline buffer is never freed
+    if (!this->is_inline()) {
+        AllocTraits::deallocate(this->alloc_, this->p_start_, this->capacity_);
+    }
+    this->p_start_ = p_start_new;
+    this->capacity_ = cap;
+}
+
+// @brief           - constructs elements from a range into raw memory.
+//                    Already built elements are destroyed on exceptions.
+// @param first     - iterator to first source element
+// @param last      - iterator past last source element
+// @param p_dest    - first raw memory slot to construct into
+template <typename T, std::size_t N, typename Alloc>
+template <typename It>
+void SmallDynamicArray<T,N,Alloc>::construct_range(It first, It last, T* p_dest) {
+    T* p_curr = p_dest;
+    try {
+        for (; first != last; ++first, ++p_curr) {
+            AllocTraits::construct(this->alloc_, p_curr, *first);
+        }
+    } catch (...) {
+        this->destroy(p_dest, p_curr);
+        throw;
+    }
+}
+
+// @brief           - destroys live elements, memory stays reserved
+// @param p_first   - first element to destroy
+// @param p_last    - element past last one to destroy
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::destroy(T* p_first, T* p_last) {
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; p_first != p_last; ++p_first) {
+            AllocTraits::destroy(this->alloc_, p_first);
+        }
+    }
+}
+
+// @brief           - creates empty array using the inline buffer
+// @param alloc     - allocator used once elements spill to the heap
+template <typename T, std::size_t N, typename Alloc>
+SmallDynamicArray<T,N,Alloc>::SmallDynamicArray(const Alloc& alloc) : alloc_(alloc) {
+    this->p_start_ = this->inline_start();
+}
+
+// @brief           - copies live elements of other array
+template <typename T, std::size_t N, typename Alloc>
+SmallDynamicArray<T,N,Alloc>::SmallDynamicArray(const SmallDynamicArray<T,N,Alloc>& other)
+    : alloc_(AllocTraits::select_on_container_copy_construction(other.alloc_)) {
+    this->p_start_ = this->inline_start();
+    if (other.size_ > N) {
+        this->reallocate(other.size_);
+    }
+
+    try {
+        this->construct_range(other.p_start_, other.p_start_ + other.size_, this->p_start_);
+    } catch (...) {
+        // destructor won't run for a partially built copy
+        if (!this->is_inline()) {
+            AllocTraits::deallocate(this->alloc_, this->p_start_, this->capacity_);
+        }
+        throw;
+    }
+    this->size_ = other.size_;
+}
+
+// @brief           - replaces elements with copies of other array's
+template <typename T, std::size_t N, typename Alloc>
+SmallDynamicArray<T,N,Alloc>& SmallDynamicArray<T,N,Alloc>::operator=(
+    const SmallDynamicArray<T,N,Alloc>& other
+) {
+    if (this != &other) {
+        // reuse current memory, only grow if other doesn't fit
+        this->destroy(this->p_start_, this->p_start_ + this->size_);
+        this->size_ = 0;
+        if (other.size_ > this->capacity_) {
+            this->reallocate(other.size_);
+        }
+
+        this->construct_range(other.p_start_, other.p_start_ + other.size_, this->p_start_);
+        this->size_ = other.size_;
+    }
+    return *this;
+}
+
+// @brief           - destroys live elements and frees heap memory
+template <typename T, std::size_t N, typename Alloc>
+SmallDynamicArray<T,N,Alloc>::~SmallDynamicArray() {
+    this->clear();
+}
+
+// @brief           - returns number of reserved memory blocks
+template <typename T, std::size_t N, typename Alloc>
+std::size_t SmallDynamicArray<T,N,Alloc>::capacity() {
+    return this->capacity_;
+}
+
+// @brief           - returns number of occupied memory blocks
+template <typename T, std::size_t N, typename Alloc>
+std::size_t SmallDynamicArray<T,N,Alloc>::length() {
+    return this->size_;
+}
+
+// @brief           - indexes some array element
+// @param idx       - integer between 0 and array length - 1
+// @return          - reference to array element selected
+template <typename T, std::size_t N, typename Alloc>
+T& SmallDynamicArray<T,N,Alloc>::at(std::size_t idx) {
+    if (idx >= this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    return *(this->p_start_ + idx);
+}
+
+// @brief           - removes last array element
+// @return          - last array element
+template <typename T, std::size_t N, typename Alloc>
+T SmallDynamicArray<T,N,Alloc>::pop() {
+    if (this->size_ == 0) {
+        throw std::range_error("No elements to pop");
+    }
+
+    T el = std::move(*(this->p_start_ + this->size_ - 1));
+    this->destroy(this->p_start_ + this->size_ - 1, this->p_start_ + this->size_);
+    --this->size_;
+    return el;
+}
+
+// @brief           - adds element to end of array
+// @param val       - value of element
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::push(T val) {
+    // spill to heap once inline buffer is full
+    if (this->size_ >= this->capacity_) {
+        this->double_capacity();
+    }
+
+    AllocTraits::construct(this->alloc_, this->p_start_ + this->size_, std::move(val));
+    ++this->size_;
+}
+
+// @brief           - creates a new element at specified index,
+//                    shifting other array els. Array size increases.
+// @param val       - value of new element
+// @param idx       - desired location of new element, 0 <= idx <= length
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::insert(T val, std::size_t idx) {
+    if (idx > this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    // handle special cases
+    if (idx == this->size_) {
+        this->push(std::move(val));
+        return;
+    } else if (this->size_ >= this->capacity_) {
+        this->double_capacity();
+    }
+
+    T* p_idx = this->p_start_ + idx;
+    T* p_end = this->p_start_ + this->size_;
+
+    // shift other elements
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        std::memmove(p_idx + 1, p_idx, (this->size_ - idx) * sizeof(T));
+        AllocTraits::construct(this->alloc_, p_idx, std::move(val));
+    } else {
+        // last element moves into raw memory, the rest into live elements
+        AllocTraits::construct(this->alloc_, p_end, std::move(*(p_end - 1)));
+        std::move_backward(p_idx, p_end - 1, p_end);
+        *p_idx = std::move(val);
+    }
+
+    ++this->size_;
+}
+
+// @brief           - sets the value of some array element, without
+//                    modifying other els. Array size unchanged.
+// @param idx       - integer between 0 and array length - 1
+// @param val       - value to set at that el
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::set(T val, std::size_t idx) {
+    if (idx >= this->size_) {
+        throw std::range_error("Invalid input index: " + std::to_string(idx));
+    }
+
+    *(this->p_start_ + idx) = std::move(val);
+}
+
+// @brief           - moves current data into 2x as large heap array
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::double_capacity() {
+    this->reallocate(this->capacity_ * 2);
+}
+
+// @brief           - deletes all elements, returns to the inline buffer
+template <typename T, std::size_t N, typename Alloc>
+void SmallDynamicArray<T,N,Alloc>::clear() {
+    this->destroy(this->p_start_, this->p_start_ + this->size_);
+    if (!this->is_inline()) {
+        AllocTraits::deallocate(this->alloc_, this->p_start_, this->capacity_);
+    }
+
+    this->size_ = 0;
+    this->capacity_ = N;
+    this->p_start_ = this->inline_start();
+}
+
+#endif
@@ -0,0 +1,78 @@
+// @file         - SmallDynamicArrayTest.cpp
+// @brief        - Testing a dynamic array with an inline buffer
+// @author       - Madhav Malhotra
+// @date         - 2023-12-24
+// @version      - 0.0.0
+// =============================================================================
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "./SmallDynamicArray.hpp"
+
+int main() {
+    SmallDynamicArray<int, 4> a_test;
+
+    // Getter methods
+    std::cout << "Initialised elements: " + std::to_string(a_test.length()) << std::endl;
+    std::cout << "Inline blocks: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // add elements, stays inline
+    for (std::size_t i = 1; i < 5; ++i) {
+        a_test.push(i);
+    }
+    std::cout << "Size after inline pushes: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+    // add elements, spills to heap
+    for (std::size_t i = 5; i < 25; ++i) {
+        a_test.push(i);
+    }
+    std::cout << "Size after spilling: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+    std::cout << "Insert elements to start: ";
+    a_test.insert(100, 0);
+    std::cout << a_test.length() << ", ";
+    a_test.insert(100, 1);
+    std::cout << a_test.length() << std::endl;
+
+    // index
+    a_test.at(0) = 15;
+    std::cout << "Edit by index: " + std::to_string(a_test.at(0)) << std::endl;
+
+    // pop
+    std::cout << "Popped: " + std::to_string(a_test.pop());
+    std::cout << ". Size: " + std::to_string(a_test.length()) << std::endl;
+
+    // copies of heap and inline arrays
+    SmallDynamicArray<int, 4> a_copy = a_test;
+    std::cout << "Copied: " + std::to_string(a_copy.length());
+    std::cout << ". Last: " + std::to_string(a_copy.at(a_copy.length() - 1)) << std::endl;
+
+    // non trivial elements, inserted across the spill boundary
+    SmallDynamicArray<std::string, 2> s_test;
+    s_test.push("b");
+    s_test.push("d");
+    s_test.insert("a", 0);
+    s_test.insert("c", 2);
+    std::cout << "Strings: ";
+    for (std::size_t i = 0; i < s_test.length(); ++i) {
+        std::cout << s_test.at(i) << " ";
+    }
+    std::cout << std::endl;
+
+    // out of range index
+    try {
+        s_test.at(4);
+    } catch (const std::range_error& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    // clear, returns to inline buffer
+    a_test.clear();
+    std::cout << "Cleared: " + std::to_string(a_test.length());
+    std::cout << ". Reserved: " + std::to_string(a_test.capacity()) << std::endl;
+
+    return 0;
+}
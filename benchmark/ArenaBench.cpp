@@ -0,0 +1,91 @@
+// @file         - ArenaBench.cpp
+// @brief        - Comparing global new against a monotonic arena allocator
+// @author       - Madhav Malhotra
+// @date         - 2023-12-24
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <vector>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../binaryheap/BinaryHeap.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+
+constexpr std::size_t REQUESTS = 2000;
+constexpr std::size_t OPS = 500;
+constexpr std::size_t ARENA_BYTES = std::size_t(1) << 24;
+
+// @brief           - runs the test workloads for one request. All containers
+//                    are built with allocators of family A from source src.
+// @param keys      - OPS random keys
+// @param src       - memory source for the allocators, e.g. an arena
+// @return          - checksum so the work can't be optimised away
+template <template <typename> class A, typename Source>
+std::size_t run_request(const std::vector<int>& keys, Source src) {
+    std::size_t checksum{0};
+    bool found = false;
+
+    DynamicArray<int, A<int>> arr(10, A<int>(src));
+    BinaryHeap<int, A<int>> heap(10, A<int>(src));
+    LP_HashTable<int, int, A<KeyValue<int,int>>> lp_map{A<KeyValue<int,int>>(src)};
+    SC_HashTable<int, int, A<KeyValue<int,int>>> sc_map{A<KeyValue<int,int>>(src)};
+
+    for (std::size_t i = 0; i < OPS; ++i) {
+        arr.push(keys[i]);
+        heap.push(keys[i]);
+        lp_map.add(keys[i], i);
+        sc_map.add(keys[i], i);
+    }
+
+    for (std::size_t i = 0; i < OPS; ++i) {
+        checksum += arr.at(i);
+        checksum += lp_map.at(keys[i], found);
+        checksum += sc_map.at(keys[i], found);
+    }
+
+    for (std::size_t i = 0; i < OPS / 2; ++i) {
+        checksum += heap.poll();
+    }
+
+    return checksum;
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(1, 10000000);
+    std::vector<int> keys(OPS);
+    for (std::size_t i = 0; i < OPS; ++i) keys[i] = dist(gen);
+
+    std::size_t checksum{0};
+
+    // every request allocates through global new
+    Timer timer{};
+    for (std::size_t r = 0; r < REQUESTS; ++r) {
+        checksum += run_request<std::allocator>(keys, std::allocator<char>{});
+    }
+    double global_ms = timer.elapsed_ms();
+
+    // every request allocates from one arena, dropped in O(1) at request end
+    std::vector<std::byte> buffer(ARENA_BYTES);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+
+    timer.reset();
+    for (std::size_t r = 0; r < REQUESTS; ++r) {
+        checksum += run_request<std::pmr::polymorphic_allocator>(keys, &arena);
+        arena.release();
+    }
+    double arena_ms = timer.elapsed_ms();
+
+    std::cout << "Requests: " << REQUESTS << ", ops per request: " << OPS << std::endl;
+    std::cout << "Global new: " << global_ms << " ms" << std::endl;
+    std::cout << "Arena: " << arena_ms << " ms" << std::endl;
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    return 0;
+}
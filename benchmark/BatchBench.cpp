@@ -0,0 +1,92 @@
+// @file         - BatchBench.cpp
+// @brief        - Comparing one at a time lookups against batched, prefetched
+//                 lookups in tables much larger than the last level cache
+// @author       - Madhav Malhotra
+// @date         - 2024-01-02
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+
+constexpr std::size_t LP_NUM = 16000000;
+constexpr std::size_t SC_NUM = 8000000;
+constexpr std::size_t LOOKUPS = 8000000;
+constexpr std::size_t CHUNK = 4096;
+
+// @brief           - fills table one pair at a time and in batches, then
+//                    looks up random stored and missing keys both ways
+// @param name      - label of run
+// @param num       - number of keys to store
+template <typename Table>
+void run(const char* name, std::size_t num) {
+    std::mt19937_64 gen(7);
+    DynamicArray<long long> keys(num);
+    DynamicArray<std::size_t> vals(num);
+    for (std::size_t i = 0; i < num; ++i) {
+        keys.push((long long)(gen() >> 1));
+        vals.push(i);
+    }
+
+    // half of the lookups miss
+    DynamicArray<long long> probes(LOOKUPS);
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        probes.push((i % 2) ? (long long)(gen() >> 1) : keys[gen() % num]);
+    }
+
+    Table single{}, batched{};
+    Timer timer{};
+    for (std::size_t i = 0; i < num; ++i) single.add(keys[i], vals[i]);
+    double add_ms = timer.elapsed_ms();
+
+    timer.reset();
+    for (std::size_t i = 0; i < num; i += CHUNK) {
+        std::size_t len = (num - i < CHUNK) ? num - i : CHUNK;
+        batched.add_batch(keys.data() + i, vals.data() + i, len);
+    }
+    double add_batch_ms = timer.elapsed_ms();
+
+    std::size_t hits{0};
+    timer.reset();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        bool found = false;
+        single.at(probes[i], found);
+        hits += found;
+    }
+    double at_ms = timer.elapsed_ms();
+
+    std::size_t batch_hits{0};
+    std::size_t out_vals[CHUNK];
+    bool out_found[CHUNK];
+    timer.reset();
+    for (std::size_t i = 0; i < LOOKUPS; i += CHUNK) {
+        std::size_t len = (LOOKUPS - i < CHUNK) ? LOOKUPS - i : CHUNK;
+        batched.at_batch(probes.data() + i, len, out_vals, out_found);
+        for (std::size_t j = 0; j < len; ++j) batch_hits += out_found[j];
+    }
+    double at_batch_ms = timer.elapsed_ms();
+
+    std::cout << name << ", " << num << " keys" << std::endl;
+    std::cout << "  add: " << add_ms << " ms, add_batch: " << add_batch_ms << " ms" << std::endl;
+    std::cout << "  at: " << at_ms * 1e6 / LOOKUPS << " ns/key, at_batch: ";
+    std::cout << at_batch_ms * 1e6 / LOOKUPS << " ns/key, hits " << hits;
+    std::cout << " / " << batch_hits << std::endl;
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+    using A = std::allocator<KeyValue<K,V>>;
+
+    run<LP_HashTable<K,V>>("LP_HashTable", LP_NUM);
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>>("LP_HashTable, mix, mask", LP_NUM);
+    run<SC_HashTable<K,V>>("SC_HashTable", SC_NUM);
+
+    return 0;
+}
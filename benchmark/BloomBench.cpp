@@ -0,0 +1,109 @@
+// @file         - BloomBench.cpp
+// @brief        - Lookups where 90% of keys miss, with and without a Bloom
+//                 front filter, and the filter alone
+// @author       - Madhav Malhotra
+// @date         - 2024-01-07
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/BloomFilter.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+
+constexpr std::size_t NUM = 4000000;
+constexpr std::size_t LOOKUPS = 8000000;
+
+// @brief           - times lookups, one stored key in ten
+// @param table     - table or filter, anything with at() or contains()
+// @param probes    - keys to look up
+// @return          - ns per lookup
+template <typename T>
+double lookups(T& table, DynamicArray<long long>& probes) {
+    std::size_t hits{0};
+    Timer timer{};
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        bool found = false;
+        table.at(probes[i], found);
+        hits += found;
+    }
+    double ns = timer.elapsed_ms() * 1e6 / LOOKUPS;
+    if (hits != LOOKUPS / 10) std::cout << "  unexpected hits: " << hits << std::endl;
+    return ns;
+}
+
+// @brief           - times batched lookups
+// @param table     - table with at_batch()
+// @param probes    - keys to look up
+// @return          - ns per lookup
+template <typename T>
+double batch_lookups(T& table, DynamicArray<long long>& probes) {
+    constexpr std::size_t CHUNK = 1024;
+    std::size_t vals[CHUNK];
+    bool found[CHUNK];
+    Timer timer{};
+    for (std::size_t i = 0; i < LOOKUPS; i += CHUNK) {
+        table.at_batch(probes.data() + i, CHUNK, vals, found);
+    }
+    return timer.elapsed_ms() * 1e6 / LOOKUPS;
+}
+
+// @brief           - fills a table, then times lookups as the filter's
+//                    false positive rate changes
+// @param name      - label of run
+// @param keys      - keys to store
+// @param probes    - keys to look up
+template <typename Table>
+void run(const char* name, DynamicArray<long long>& keys, DynamicArray<long long>& probes) {
+    Table table{};
+    for (std::size_t i = 0; i < NUM; ++i) table.add(keys[i], i);
+
+    std::cout << name << ", " << table.count() << " keys" << std::endl;
+    for (double fpr : {0.0, 0.05, 0.01, 0.001}) {
+        table.set_filter_fpr(fpr);
+        double ns = lookups(table, probes);
+        double batch_ns = batch_lookups(table, probes);
+        if (fpr == 0) std::cout << "  no filter: ";
+        else std::cout << "  filter at " << fpr * 100 << "%: ";
+        std::cout << ns << " ns/key, batched " << batch_ns << " ns/key" << std::endl;
+    }
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+    using A = std::allocator<KeyValue<K,V>>;
+
+    // stored keys are even and missing keys odd, 90% of lookups miss
+    std::mt19937_64 gen(11);
+    DynamicArray<K> keys(NUM);
+    for (std::size_t i = 0; i < NUM; ++i) keys.push(K(gen() >> 1) & ~1LL);
+    DynamicArray<K> probes(LOOKUPS);
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        probes.push((i % 10) ? K(gen() >> 1) | 1LL : keys[gen() % NUM]);
+    }
+
+    // the filter alone, rate measured over the misses
+    for (double fpr : {0.05, 0.01, 0.001}) {
+        BloomFilter<K> filter(NUM, fpr);
+        for (std::size_t i = 0; i < NUM; ++i) filter.add(keys[i]);
+        std::size_t positives{0};
+        Timer timer{};
+        for (std::size_t i = 0; i < LOOKUPS; ++i) positives += filter.contains(probes[i]);
+        double ns = timer.elapsed_ms() * 1e6 / LOOKUPS;
+        double measured = double(positives - LOOKUPS / 10) / double(LOOKUPS - LOOKUPS / 10);
+        std::cout << "BloomFilter at " << fpr * 100 << "%: " << filter.memory() / 1e6 << " MB, ";
+        std::cout << filter.hashes() << " hashes, " << ns << " ns/key, measured rate ";
+        std::cout << measured * 100 << "%" << std::endl;
+    }
+
+    // without the filter, a miss walks its whole probe run
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>>("LP_HashTable, mix, mask", keys, probes);
+    run<LP_HashTable<K,V,A,MixHash<K>,QuadraticProbe,MaskReduce>>("LP_HashTable, mix, quadratic", keys, probes);
+
+    return 0;
+}
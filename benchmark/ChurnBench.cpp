@@ -0,0 +1,60 @@
+// @file         - ChurnBench.cpp
+// @brief        - Insert/delete churn at constant size, comparing backward
+//                 shift deletion against tombstones
+// @author       - Madhav Malhotra
+// @date         - 2023-12-30
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include "./Timer.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/RobinHood.hpp"
+#include "../hashtable/SwissTable.hpp"
+
+constexpr std::size_t LIVE = 100000;
+constexpr std::size_t CYCLES = 5000000;
+
+// @brief           - keeps LIVE keys stored while CYCLES times adding a new
+//                    key and removing the oldest, like expiring sessions
+// @param name      - label of run
+template <typename Table>
+void run(const char* name) {
+    Table table{};
+    for (std::size_t i = 0; i < LIVE; ++i) table.add((long long)(i * 7919), i);
+
+    Timer timer{};
+    for (std::size_t i = LIVE; i < LIVE + CYCLES; ++i) {
+        table.add((long long)(i * 7919), i);
+        table.remove((long long)((i - LIVE) * 7919));
+    }
+    double churn_ms = timer.elapsed_ms();
+
+    // lookups after churn show whether probe lengths stayed bounded
+    std::size_t hits{0};
+    timer.reset();
+    for (std::size_t i = CYCLES; i < CYCLES + LIVE; ++i) {
+        hits += table.find((long long)(i * 7919)) != nullptr;
+    }
+    double hit_ms = timer.elapsed_ms();
+
+    std::cout << name << ": " << churn_ms << " ms churn (";
+    std::cout << churn_ms * 1e6 / CYCLES << " ns/cycle), " << hit_ms << " ms for ";
+    std::cout << hits << " hits, load " << table.load_factor() << std::endl;
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+    using A = std::allocator<KeyValue<K,V>>;
+
+    run<LP_HashTable<K,V>>("LP_HashTable, linear, backward shift");
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>>("LP_HashTable, mix, linear, mask, backward shift");
+    run<LP_HashTable<K,V,A,MixHash<K>,QuadraticProbe,MaskReduce>>("LP_HashTable, mix, quadratic, mask, tombstones");
+    run<RH_HashTable<K,V>>("RH_HashTable, backward shift");
+    run<SW_HashTable<K,V>>("SW_HashTable, tombstones");
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// @file         - ConcurrentBench.cpp
+// @brief        - Comparing appends from many threads into a mutex guarded
+//                 DynamicArray against a lock free ConcurrentArray
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - scaling is limited by the machine's core count
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "./Timer.hpp"
+#include "../array/ConcurrentArray.hpp"
+#include "../array/DynamicArray.hpp"
+
+constexpr std::size_t NUM = 8000000;
+
+// @brief           - prints time and throughput of one run
+// @param name      - label of run
+// @param threads   - number of writer threads
+// @param ms        - elapsed milliseconds
+void report(const char* name, std::size_t threads, double ms) {
+    std::cout << "  " << name << ", " << threads << " threads: " << ms << " ms, ";
+    std::cout << double(NUM) / ms / 1000.0 << " M pushes/s" << std::endl;
+}
+
+// @brief           - splits NUM pushes across threads, returns elapsed ms
+// @param threads   - number of writer threads
+// @param push      - called with each value to append
+template <typename Push>
+double run(std::size_t threads, Push push) {
+    Timer timer{};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&push, t, threads]() {
+            for (std::size_t i = t; i < NUM; i += threads) push(i);
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    return timer.elapsed_ms();
+}
+
+int main() {
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        std::cout << threads << " threads" << std::endl;
+
+        DynamicArray<std::size_t> locked(16);
+        std::mutex lock;
+        double ms = run(threads, [&](std::size_t val) {
+            std::lock_guard<std::mutex> guard(lock);
+            locked.push(val);
+        });
+        report("DynamicArray + mutex", threads, ms);
+
+        ConcurrentArray<std::size_t> lock_free;
+        ms = run(threads, [&](std::size_t val) {
+            lock_free.push(val);
+        });
+        report("ConcurrentArray", threads, ms);
+
+        if (locked.length() != lock_free.length()) {
+            std::cout << "  length mismatch" << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+// @file         - CuckooBench.cpp
+// @brief        - Comparing hit and miss lookups of linear probing, Robin Hood
+//                 and bucketized cuckoo hash tables at the same high load
+// @author       - Madhav Malhotra
+// @date         - 2024-01-03
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/Cuckoo.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/RobinHood.hpp"
+
+// 0.877 of a bucket count reached by doubling 10, and of a cuckoo slot
+// count reached by doubling 16, so every table is measured at the same load
+constexpr std::size_t NUM = 1150000;
+constexpr std::size_t CK_NUM = 1840000;
+constexpr std::size_t ROUNDS = 5;
+
+// @brief           - fills table, then times lookups of stored and missing keys
+// @param name      - label of run
+// @param threshold - load threshold of table
+// @param num       - number of keys to store
+// @param keys      - CK_NUM keys to store, followed by CK_NUM keys never stored
+template <typename Table>
+void run(const char* name, float threshold, std::size_t num, DynamicArray<long long>& keys) {
+    Table table{};
+    table.set_load_threshold(threshold);
+
+    Timer timer{};
+    for (std::size_t i = 0; i < num; ++i) table.add(keys[i], i);
+    double add_ms = timer.elapsed_ms();
+
+    std::size_t hits{0};
+    timer.reset();
+    for (std::size_t r = 0; r < ROUNDS; ++r) {
+        for (std::size_t i = 0; i < num; ++i) hits += table.find(keys[i]) != nullptr;
+    }
+    double hit_ns = timer.elapsed_ms() * 1e6 / double(ROUNDS * num);
+
+    std::size_t misses{0};
+    timer.reset();
+    for (std::size_t r = 0; r < ROUNDS; ++r) {
+        for (std::size_t i = CK_NUM; i < CK_NUM + num; ++i) misses += table.find(keys[i]) == nullptr;
+    }
+    double miss_ns = timer.elapsed_ms() * 1e6 / double(ROUNDS * num);
+
+    std::cout << name << " @ " << threshold << " (load " << table.load_factor() << "): ";
+    std::cout << add_ms << " ms add, " << hit_ns << " ns/hit, " << miss_ns << " ns/miss";
+    std::cout << " (" << hits / ROUNDS << " hits, " << misses / ROUNDS << " misses)" << std::endl;
+}
+
+int main() {
+    // odd keys are stored, even keys are looked up as misses
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> dist(0, (1LL << 40));
+    DynamicArray<long long> keys(2 * CK_NUM);
+    for (std::size_t i = 0; i < CK_NUM; ++i) keys.push(dist(gen) | 1);
+    for (std::size_t i = 0; i < CK_NUM; ++i) keys.push(dist(gen) & ~1LL);
+
+    run<LP_HashTable<long long, std::size_t>>("LP_HashTable", 0.9, NUM, keys);
+    run<RH_HashTable<long long, std::size_t>>("RH_HashTable", 0.9, NUM, keys);
+    run<CK_HashTable<long long, std::size_t>>("CK_HashTable", 0.9, CK_NUM, keys);
+
+    // Robin Hood probes grow with load, cuckoo lookups read two buckets at most
+    RH_HashTable<long long, std::size_t> rh_table{};
+    rh_table.set_load_threshold(0.9);
+    for (std::size_t i = 0; i < NUM; ++i) rh_table.add(keys[i], i);
+    std::cout << "Longest RH_HashTable probe: " << rh_table.max_probe() << " buckets, ";
+    std::cout << "CK_HashTable: 2 buckets" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// @file         - FreezeBench.cpp
+// @brief        - Build time, memory and lookup throughput of frozen perfect
+//                 hash tables against the live tables they're built from
+// @author       - Madhav Malhotra
+// @date         - 2024-01-06
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/FrozenTable.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+
+constexpr std::size_t NUM = 8000000;
+constexpr std::size_t LOOKUPS = 8000000;
+
+// @brief           - times lookups, half of stored keys and half missing
+// @param table     - live or frozen table
+// @param probes    - keys to look up
+// @return          - ns per lookup
+template <typename T>
+double lookups(T& table, DynamicArray<long long>& probes) {
+    std::size_t hits{0};
+    Timer timer{};
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        bool found = false;
+        table.at(probes[i], found);
+        hits += found;
+    }
+    double ns = timer.elapsed_ms() * 1e6 / LOOKUPS;
+    if (hits != LOOKUPS / 2) std::cout << "  unexpected hits: " << hits << std::endl;
+    return ns;
+}
+
+// @brief           - fills a table, freezes it, compares lookups
+// @param name      - label of run
+// @param bytes     - callable estimating the live table's memory
+template <typename Table, typename Bytes>
+void run(const char* name, Bytes bytes) {
+    // stored keys are even and missing keys odd, half of the lookups miss
+    std::mt19937_64 gen(7);
+    DynamicArray<long long> keys(NUM);
+    for (std::size_t i = 0; i < NUM; ++i) keys.push((long long)(gen() >> 1) & ~1LL);
+    DynamicArray<long long> probes(LOOKUPS);
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        probes.push((i % 2) ? (long long)(gen() >> 1) | 1LL : keys[gen() % NUM]);
+    }
+
+    Table table{};
+    for (std::size_t i = 0; i < NUM; ++i) table.add(keys[i], i);
+    double live_mb = bytes(table) / 1e6;
+
+    Timer timer{};
+    FrozenTable<long long, std::size_t> frozen = table.freeze();
+    double freeze_ms = timer.elapsed_ms();
+
+    double live_ns = lookups(table, probes);
+    double frozen_ns = lookups(frozen, probes);
+
+    std::cout << name << ", " << frozen.count() << " keys" << std::endl;
+    std::cout << "  freeze: " << freeze_ms << " ms" << std::endl;
+    std::cout << "  memory: live " << live_mb << " MB, frozen " << frozen.memory() / 1e6;
+    std::cout << " MB" << std::endl;
+    std::cout << "  at: live " << live_ns << " ns/key, frozen " << frozen_ns << " ns/key" << std::endl;
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+    using A = std::allocator<KeyValue<K,V>>;
+    using LP = LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>;
+
+    run<LP>("LP_HashTable, mix, mask", [](LP& table) {
+        return double(table.count()) / double(table.load_factor()) * sizeof(KeyValue<K,V>);
+    });
+
+    // lower bound of chain nodes alone, a pair and a next pointer each
+    run<SC_HashTable<K,V>>("SC_HashTable", [](SC_HashTable<K,V>& table) {
+        return double(table.count()) * (sizeof(KeyValue<K,V>) + sizeof(void*));
+    });
+
+    return 0;
+}
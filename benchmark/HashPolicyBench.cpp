@@ -0,0 +1,94 @@
+// @file         - HashPolicyBench.cpp
+// @brief        - Comparing hasher, probing and reduction policies of
+//                 LP_HashTable on sequential, strided and random keys
+// @author       - Madhav Malhotra
+// @date         - 2023-12-29
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+
+constexpr std::size_t NUM = 1000000;
+constexpr std::size_t NUM_STR = 200000;
+
+// @brief           - times adds, then hit and miss lookups
+// @param name      - label of run
+// @param keys      - NUM keys to store, followed by NUM keys never stored
+template <typename Table, typename Key>
+void run(const char* name, DynamicArray<Key>& keys) {
+    std::size_t num = keys.length() / 2;
+    Table table{};
+
+    Timer timer{};
+    for (std::size_t i = 0; i < num; ++i) table.add(keys[i], i);
+    double add_ms = timer.elapsed_ms();
+
+    std::size_t hits{0};
+    timer.reset();
+    for (std::size_t i = 0; i < num; ++i) hits += table.find(keys[i]) != nullptr;
+    double hit_ms = timer.elapsed_ms();
+
+    std::size_t misses{0};
+    timer.reset();
+    for (std::size_t i = num; i < 2 * num; ++i) misses += table.find(keys[i]) == nullptr;
+    double miss_ms = timer.elapsed_ms();
+
+    std::cout << "  " << name << ": " << add_ms << " ms add, " << hit_ms << " ms hit, ";
+    std::cout << miss_ms << " ms miss (" << hits << " hits, " << misses << " misses)" << std::endl;
+}
+
+// @brief           - runs every integer policy combination on a key set
+// @param name      - label of key set
+// @param keys      - NUM keys to store, followed by NUM keys never stored
+void run_all(const char* name, DynamicArray<long long>& keys) {
+    using K = long long;
+    using V = std::size_t;
+    using A = std::allocator<KeyValue<K,V>>;
+
+    std::cout << name << std::endl;
+    run<LP_HashTable<K,V,A>>("std::hash, linear, modulo", keys);
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,ModuloReduce>>("mix, linear, modulo", keys);
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>>("mix, linear, mask", keys);
+    run<LP_HashTable<K,V,A,MixHash<K>,LinearProbe,FastRangeReduce>>("mix, linear, fastrange", keys);
+    run<LP_HashTable<K,V,A,MixHash<K>,QuadraticProbe,MaskReduce>>("mix, quadratic, mask", keys);
+    run<LP_HashTable<K,V,A,MixHash<K>,DoubleHashProbe,MaskReduce>>("mix, double, mask", keys);
+}
+
+int main() {
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> dist(0, (1LL << 40));
+
+    // sequential ids, misses continue the sequence
+    DynamicArray<long long> seq(2 * NUM);
+    for (std::size_t i = 0; i < 2 * NUM; ++i) seq.push((long long)i);
+    run_all("Sequential keys", seq);
+
+    // ids with a power of 2 stride, as from aligned addresses or packed ids
+    DynamicArray<long long> strided(2 * NUM);
+    for (std::size_t i = 0; i < 2 * NUM; ++i) strided.push((long long)(i << 6));
+    run_all("Strided keys", strided);
+
+    // odd keys are stored, even keys are looked up as misses
+    DynamicArray<long long> rand(2 * NUM);
+    for (std::size_t i = 0; i < NUM; ++i) rand.push(dist(gen) | 1);
+    for (std::size_t i = 0; i < NUM; ++i) rand.push(dist(gen) & ~1LL);
+    run_all("Random keys", rand);
+
+    // string keys
+    using S = std::string;
+    using SA = std::allocator<KeyValue<S,std::size_t>>;
+    DynamicArray<S> strs(2 * NUM_STR);
+    for (std::size_t i = 0; i < 2 * NUM_STR; ++i) strs.push("user:" + std::to_string(i));
+    std::cout << "String keys" << std::endl;
+    run<LP_HashTable<S,std::size_t,SA>>("std::hash, linear, modulo", strs);
+    run<LP_HashTable<S,std::size_t,SA,MixHash<S>,LinearProbe,MaskReduce>>("mix, linear, mask", strs);
+
+    return 0;
+}
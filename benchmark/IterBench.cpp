@@ -0,0 +1,69 @@
+// @file         - IterBench.cpp
+// @brief        - Time to iterate every entry of dense and sparse hash
+//                 tables, where sparse tables are mostly empty buckets
+// @author       - Madhav Malhotra
+// @date         - 2024-01-04
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include "./Timer.hpp"
+#include "../hashtable/KeyValue.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+#include "../hashtable/SwissTable.hpp"
+
+constexpr std::size_t NUM = 2000000;
+constexpr std::size_t PASSES = 10;
+
+// @brief           - scrambles i so keys don't fill consecutive buckets,
+//                    an odd multiplier is a bijection on 64 bit keys
+long long key(std::size_t i) {
+    return (long long)((i * 0x9e3779b97f4a7c15ULL) >> 1);
+}
+
+// @brief           - fills a table, times full iterations, then removes all
+//                    but every 32nd key and times iterating the sparse table
+// @param name      - label of run
+template <typename Table>
+void run(const char* name) {
+    Table table{};
+    for (std::size_t i = 0; i < NUM; ++i) table.add(key(i), i);
+
+    // sums are printed so the loops can't be optimised out
+    std::size_t dense_sum{0};
+    Timer timer{};
+    for (std::size_t p = 0; p < PASSES; ++p) {
+        for (KeyValue<long long, std::size_t>& kv : table) dense_sum += kv.val;
+    }
+    double dense_ms = timer.elapsed_ms() / PASSES;
+
+    for (std::size_t i = 0; i < NUM; ++i) {
+        if (i % 32) table.remove(key(i));
+    }
+
+    std::size_t sparse_sum{0};
+    timer.reset();
+    for (std::size_t p = 0; p < PASSES; ++p) {
+        for (KeyValue<long long, std::size_t>& kv : table) sparse_sum += kv.val;
+    }
+    double sparse_ms = timer.elapsed_ms() / PASSES;
+
+    std::cout << name << std::endl;
+    std::cout << "  dense: " << dense_ms << " ms, " << dense_ms * 1e6 / NUM << " ns/entry, sum ";
+    std::cout << dense_sum << std::endl;
+    std::cout << "  sparse: " << sparse_ms << " ms, " << sparse_ms * 1e6 / table.count();
+    std::cout << " ns/entry, sum " << sparse_sum << std::endl;
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+
+    run<LP_HashTable<K,V>>("LP_HashTable, scans every bucket");
+    run<SC_HashTable<K,V>>("SC_HashTable, walks bucket lists");
+    run<SW_HashTable<K,V>>("SW_HashTable, skips empty groups by control bytes");
+
+    return 0;
+}
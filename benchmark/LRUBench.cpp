@@ -0,0 +1,196 @@
+// @file         - LRUBench.cpp
+// @brief        - Get or put throughput and hit rate of pooled LRU caches
+//                 against a std::list and std::unordered_map cache, and of
+//                 sharded caches against one cache behind a global mutex
+// @author       - Madhav Malhotra
+// @date         - 2024-01-08
+// @version      - 0.0.0
+// @note         - scaling is limited by the machine's core count
+// =============================================================================
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../cache/LRUCache.hpp"
+#include "../cache/ShardedLRUCache.hpp"
+
+constexpr std::size_t CAPACITY = 100000;
+constexpr std::size_t KEYS = 1000000;
+constexpr std::size_t OPS = 8000000;
+
+// the usual hand written cache, a node allocated per put and freed per evict
+template <typename K, typename V>
+class ListCache {
+    private:
+        using List = std::list<std::pair<K, V>>;
+
+        List list_{};
+        std::unordered_map<K, typename List::iterator> map_{};
+        std::size_t capacity_{};
+
+    public:
+        ListCache(std::size_t capacity) : capacity_(capacity) {
+            this->map_.reserve(capacity);
+        }
+
+        V* find(const K& key) {
+            auto it = this->map_.find(key);
+            if (it == this->map_.end()) return nullptr;
+            this->list_.splice(this->list_.begin(), this->list_, it->second);
+            return &it->second->second;
+        }
+
+        bool put(K key, V val) {
+            auto it = this->map_.find(key);
+            if (it != this->map_.end()) {
+                it->second->second = std::move(val);
+                this->list_.splice(this->list_.begin(), this->list_, it->second);
+                return true;
+            }
+            if (this->list_.size() == this->capacity_) {
+                this->map_.erase(this->list_.back().first);
+                this->list_.pop_back();
+            }
+            this->list_.emplace_front(key, std::move(val));
+            this->map_.emplace(key, this->list_.begin());
+            return true;
+        }
+};
+
+// one cache behind one global mutex, the baseline of the sharded cache
+template <typename K, typename V>
+class LockedCache {
+    private:
+        std::mutex lock_{};
+        LRUCache<K,V> cache_;
+
+    public:
+        LockedCache(std::size_t capacity) : cache_(capacity) {}
+
+        bool put(K key, V val) {
+            std::lock_guard<std::mutex> guard(this->lock_);
+            return this->cache_.put(key, val);
+        }
+
+        V at(const K& key, bool& found) {
+            std::lock_guard<std::mutex> guard(this->lock_);
+            return this->cache_.at(key, found);
+        }
+};
+
+// @brief           - draws keys in [0, KEYS) with a Zipf like skew, rank r
+//                    weighted 1 / (r + 1)^skew, by inverting the continuous
+//                    approximation of the distribution
+// @param skew      - exponent, 0 is uniform
+// @return          - OPS keys, scattered so hot keys aren't adjacent
+DynamicArray<long long> zipf_keys(double skew) {
+    std::mt19937_64 gen(11);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    DynamicArray<long long> keys(OPS);
+    double top = std::pow(double(KEYS) + 1, 1 - skew) - 1;
+    for (std::size_t i = 0; i < OPS; ++i) {
+        double rank = std::pow(1 + unit(gen) * top, 1 / (1 - skew)) - 1;
+        std::uint64_t r = std::uint64_t(rank) % KEYS;
+        keys.push((long long)((r * 0x9e3779b97f4a7c15ULL) >> 1));
+    }
+    return keys;
+}
+
+// @brief           - gets each key, putting it on a miss, as a read through
+//                    cache would
+// @param cache     - empty cache of CAPACITY entries
+// @param keys      - keys to get
+// @param name      - label of run
+template <typename Cache>
+void single(Cache& cache, DynamicArray<long long>& keys, const char* name) {
+    std::size_t hits{0};
+    Timer timer{};
+    for (std::size_t i = 0; i < OPS; ++i) {
+        if (cache.find(keys[i])) {
+            ++hits;
+        } else {
+            cache.put(keys[i], i);
+        }
+    }
+    double ns = timer.elapsed_ms() * 1e6 / OPS;
+    std::cout << "  " << name << ": " << ns << " ns/op, hit rate ";
+    std::cout << double(hits) / OPS << std::endl;
+}
+
+// @brief           - splits the get or put loop across threads
+// @param cache     - cache with at() and put()
+// @param keys      - keys to get
+// @param threads   - number of worker threads
+// @return          - elapsed ms
+template <typename Cache>
+double run(Cache& cache, DynamicArray<long long>& keys, std::size_t threads) {
+    // hits are summed so lookups can't be optimised out
+    std::atomic<std::size_t> total_hits{0};
+    Timer timer{};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&cache, &keys, &total_hits, t, threads]() {
+            std::size_t hits{0};
+            for (std::size_t i = t; i < OPS; i += threads) {
+                bool found = false;
+                cache.at(keys[i], found);
+                if (found) {
+                    ++hits;
+                } else {
+                    cache.put(keys[i], i);
+                }
+            }
+            total_hits += hits;
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    return timer.elapsed_ms();
+}
+
+// @brief           - runs a fresh cache at each thread count
+// @param keys      - keys to get
+// @param name      - label of cache
+template <typename Cache>
+void scale(DynamicArray<long long>& keys, const char* name) {
+    std::cout << name << std::endl;
+    for (std::size_t threads : {1, 2, 4, 8, 16}) {
+        Cache* cache = new Cache(CAPACITY);
+        double ms = run(*cache, keys, threads);
+        std::cout << "  " << threads << " threads: " << ms << " ms, ";
+        std::cout << double(OPS) / ms / 1000.0 << " M ops/s" << std::endl;
+        delete cache;
+    }
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+
+    // a cache of a tenth of the keys, from near uniform to heavily skewed
+    for (double skew : {0.5, 0.9, 1.2}) {
+        DynamicArray<long long> keys = zipf_keys(skew);
+        std::cout << "Zipf skew " << skew << ", " << CAPACITY << " of " << KEYS << " keys" << std::endl;
+
+        ListCache<K,V> list_cache(CAPACITY);
+        single(list_cache, keys, "std::list + std::unordered_map");
+        LRUCache<K,V> cache(CAPACITY);
+        single(cache, keys, "LRUCache");
+    }
+
+    DynamicArray<long long> keys = zipf_keys(0.9);
+    scale<LockedCache<K,V>>(keys, "LRUCache + mutex, Zipf skew 0.9");
+    scale<ShardedLRUCache<K,V>>(keys, "ShardedLRUCache, 16 shards, Zipf skew 0.9");
+
+    return 0;
+}
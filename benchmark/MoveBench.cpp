@@ -0,0 +1,98 @@
+// @file         - MoveBench.cpp
+// @brief        - Counting copies of a heavy payload made by each container
+//                 when elements are copied in, moved in or emplaced
+// @author       - Madhav Malhotra
+// @date         - 2023-12-26
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../linkedlist/SinglyLinkedList.hpp"
+#include "../binaryheap/BinaryHeap.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+
+constexpr std::size_t NUM = 200000;
+constexpr std::size_t PAYLOAD = 256;
+
+// heavy element, a heap allocated buffer that counts its deep copies.
+// Copies of empty, default constructed elements (e.g. fill values for new
+// hash table buckets) aren't counted.
+struct Heavy {
+    static std::size_t copies;
+    std::string buf{};
+    int key{};
+
+    Heavy() = default;
+    Heavy(int k) : buf(PAYLOAD, char('a' + k % 26)), key(k) {}
+    Heavy(const Heavy& other) : buf(other.buf), key(other.key) {
+        copies += !buf.empty();
+    }
+    Heavy(Heavy&& other) noexcept = default;
+    Heavy& operator=(const Heavy& other) {
+        buf = other.buf;
+        key = other.key;
+        copies += !buf.empty();
+        return *this;
+    }
+    Heavy& operator=(Heavy&& other) noexcept = default;
+
+    bool operator==(const Heavy& other) const { return key == other.key; }
+    bool operator<(const Heavy& other) const { return key < other.key; }
+    bool operator>(const Heavy& other) const { return key > other.key; }
+    bool operator<=(const Heavy& other) const { return key <= other.key; }
+};
+std::size_t Heavy::copies = 0;
+
+// @brief           - times a run of NUM operations and reports copies per op
+// @param name      - label of run
+// @param op        - performs operation i
+template <typename Op>
+void run(const char* name, Op op) {
+    Heavy::copies = 0;
+    Timer timer{};
+    for (std::size_t i = 0; i < NUM; ++i) op(int(i));
+    double ms = timer.elapsed_ms();
+
+    std::cout << name << ": " << ms << " ms, ";
+    std::cout << double(Heavy::copies) / double(NUM) << " copies/op" << std::endl;
+}
+
+int main() {
+    {
+        DynamicArray<Heavy> copied(1), moved(1), emplaced(1);
+        run("DynamicArray push(lvalue)", [&](int i) { Heavy h(i); copied.push(h); });
+        run("DynamicArray push(move)", [&](int i) { Heavy h(i); moved.push(std::move(h)); });
+        run("DynamicArray emplace_back", [&](int i) { emplaced.emplace_back(i); });
+    }
+    {
+        SLList<Heavy> copied{}, emplaced{};
+        run("SLList push(lvalue)", [&](int i) { Heavy h(i); copied.push(h); });
+        run("SLList emplace_back", [&](int i) { emplaced.emplace_back(i); });
+    }
+    {
+        BinaryHeap<Heavy> copied{}, emplaced{};
+        run("BinaryHeap push(lvalue)", [&](int i) { Heavy h(i); copied.push(h); });
+        run("BinaryHeap emplace", [&](int i) { emplaced.emplace(i); });
+        run("BinaryHeap poll", [&](int) { emplaced.poll(); });
+    }
+    {
+        LP_HashTable<int, Heavy> copied{}, emplaced{};
+        run("LP_HashTable add(lvalue)", [&](int i) { Heavy h(i); copied.add(i, h); });
+        run("LP_HashTable emplace", [&](int i) { emplaced.emplace(i, i); });
+        run("LP_HashTable find", [&](int i) { emplaced.find(i)->key += 1; });
+    }
+    {
+        SC_HashTable<int, Heavy> copied{}, emplaced{};
+        run("SC_HashTable add(lvalue)", [&](int i) { Heavy h(i); copied.add(i, h); });
+        run("SC_HashTable emplace", [&](int i) { emplaced.emplace(i, i); });
+        run("SC_HashTable find", [&](int i) { emplaced.find(i)->key += 1; });
+    }
+
+    return 0;
+}
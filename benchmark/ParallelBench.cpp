@@ -0,0 +1,66 @@
+// @file         - ParallelBench.cpp
+// @brief        - Comparing parallel std algorithms over DynamicArray iterators
+//                 against element by element at() loops
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - parallel policies need TBB with libstdc++, link with -ltbb
+// =============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+
+constexpr std::size_t NUM = 10000000;
+
+// @brief           - prints time and throughput of one run
+// @param name      - label of run
+// @param ms        - elapsed milliseconds
+void report(const char* name, double ms) {
+    std::cout << name << ": " << ms << " ms, ";
+    std::cout << double(NUM) / ms / 1000.0 << " M els/s" << std::endl;
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<long long> dist(0, 1000000);
+    DynamicArray<long long> arr(NUM);
+    for (std::size_t i = 0; i < NUM; ++i) arr.push(dist(gen));
+    DynamicArray<long long> copy = arr;
+
+    // reduce
+    Timer timer{};
+    long long at_sum{0};
+    for (std::size_t i = 0; i < arr.length(); ++i) {
+        at_sum += arr.at(i);
+    }
+    report("Sum, at() loop", timer.elapsed_ms());
+
+    timer.reset();
+    long long par_sum = std::reduce(std::execution::par_unseq, arr.begin(), arr.end());
+    report("Sum, reduce par_unseq", timer.elapsed_ms());
+
+    // sort, previously by copying through a std::vector
+    timer.reset();
+    std::vector<long long> vec(arr.length());
+    for (std::size_t i = 0; i < arr.length(); ++i) vec[i] = arr.at(i);
+    std::sort(vec.begin(), vec.end());
+    for (std::size_t i = 0; i < arr.length(); ++i) arr.at(i) = vec[i];
+    report("Sort, at() copy to vector", timer.elapsed_ms());
+
+    timer.reset();
+    std::sort(std::execution::par_unseq, copy.begin(), copy.end());
+    report("Sort, sort par_unseq", timer.elapsed_ms());
+
+    bool same = std::equal(arr.begin(), arr.end(), copy.begin());
+    std::cout << "Sums match: " << (at_sum == par_sum);
+    std::cout << ", sorts match: " << same << std::endl;
+
+    return 0;
+}
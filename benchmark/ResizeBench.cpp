@@ -0,0 +1,69 @@
+// @file         - ResizeBench.cpp
+// @brief        - Worst case add latency while tables grow, comparing one
+//                 shot rehashing against incremental resizing
+// @author       - Madhav Malhotra
+// @date         - 2023-12-31
+// @version      - 0.0.0
+// =============================================================================
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+
+constexpr std::size_t LP_NUM = 10000000;
+constexpr std::size_t SC_NUM = 4000000;
+
+// @brief           - times every add of num keys into an empty table, then
+//                    looks every key up, reporting tail and max add latency
+// @param name      - label of run
+// @param num       - number of keys
+// @param step      - resize step, 0 rehashes all at once
+template <typename Table>
+void run(const char* name, std::size_t num, std::size_t step) {
+    Table table{};
+    table.set_resize_step(step);
+    DynamicArray<double> lat(num);
+
+    Timer total{};
+    Timer timer{};
+    for (std::size_t i = 0; i < num; ++i) {
+        timer.reset();
+        table.add((long long)(i * 7919), i);
+        lat.push(timer.elapsed_ms());
+    }
+    double add_ms = total.elapsed_ms();
+
+    std::size_t hits{0};
+    total.reset();
+    for (std::size_t i = 0; i < num; ++i) {
+        hits += table.find((long long)(i * 7919)) != nullptr;
+    }
+    double find_ms = total.elapsed_ms();
+
+    double max = *std::max_element(lat.begin(), lat.end());
+    std::size_t rank = num - num / 1000;
+    std::nth_element(lat.begin(), lat.begin() + rank, lat.end());
+    double p999 = lat.at(rank);
+
+    std::cout << name << ", step " << step << ": " << add_ms << " ms adds, max ";
+    std::cout << max << " ms, p99.9 " << p999 * 1e6 << " ns, " << find_ms << " ms for ";
+    std::cout << hits << " hits" << std::endl;
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+
+    run<LP_HashTable<K,V>>("LP_HashTable", LP_NUM, 0);
+    run<LP_HashTable<K,V>>("LP_HashTable", LP_NUM, 8);
+    run<LP_HashTable<K,V>>("LP_HashTable", LP_NUM, 64);
+    run<SC_HashTable<K,V>>("SC_HashTable", SC_NUM, 0);
+    run<SC_HashTable<K,V>>("SC_HashTable", SC_NUM, 4);
+    run<SC_HashTable<K,V>>("SC_HashTable", SC_NUM, 32);
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+// @file         - RobinHoodBench.cpp
+// @brief        - Comparing hit and miss lookups of linear probing against
+//                 Robin Hood probing, at default and high load thresholds
+// @author       - Madhav Malhotra
+// @date         - 2023-12-27
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/RobinHood.hpp"
+
+// just under 0.9 of a bucket count reached by doubling 10, so high threshold
+// tables are measured near full load
+constexpr std::size_t NUM = 1150000;
+
+// @brief           - fills table, then times lookups of stored and missing keys
+// @param name      - label of run
+// @param threshold - load threshold of table
+// @param keys      - NUM keys to store, followed by NUM keys never stored
+template <typename Table>
+void run(const char* name, float threshold, DynamicArray<long long>& keys) {
+    Table table{};
+    table.set_load_threshold(threshold);
+
+    Timer timer{};
+    for (std::size_t i = 0; i < NUM; ++i) table.add(keys[i], i);
+    double add_ms = timer.elapsed_ms();
+
+    std::size_t hits{0};
+    timer.reset();
+    for (std::size_t i = 0; i < NUM; ++i) hits += table.find(keys[i]) != nullptr;
+    double hit_ms = timer.elapsed_ms();
+
+    std::size_t misses{0};
+    timer.reset();
+    for (std::size_t i = NUM; i < 2 * NUM; ++i) misses += table.find(keys[i]) == nullptr;
+    double miss_ms = timer.elapsed_ms();
+
+    std::cout << name << " @ " << threshold << " (load " << table.load_factor() << "): ";
+    std::cout << add_ms << " ms add, " << hit_ms << " ms hit, " << miss_ms << " ms miss";
+    std::cout << " (" << hits << " hits, " << misses << " misses)" << std::endl;
+}
+
+int main() {
+    // odd keys are stored, even keys are looked up as misses
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<long long> dist(0, (1LL << 40));
+    DynamicArray<long long> keys(2 * NUM);
+    for (std::size_t i = 0; i < NUM; ++i) keys.push(dist(gen) | 1);
+    for (std::size_t i = 0; i < NUM; ++i) keys.push(dist(gen) & ~1LL);
+
+    run<LP_HashTable<long long, std::size_t>>("LP_HashTable", 0.7, keys);
+    run<LP_HashTable<long long, std::size_t>>("LP_HashTable", 0.9, keys);
+    run<RH_HashTable<long long, std::size_t>>("RH_HashTable", 0.7, keys);
+    run<RH_HashTable<long long, std::size_t>>("RH_HashTable", 0.9, keys);
+
+    return 0;
+}
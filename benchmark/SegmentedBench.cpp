@@ -0,0 +1,54 @@
+// @file         - SegmentedBench.cpp
+// @brief        - Comparing growth of DynamicArray, which copies its buffer
+//                 on each resize, against chunked SegmentedArray
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - pushes 200M ints, DynamicArray briefly holds ~1.6 GB
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../array/SegmentedArray.hpp"
+
+constexpr std::size_t NUM = 200000000;
+
+// @brief           - pushes NUM elements, tracking slowest single push
+// @param name      - label of run
+template <typename Array>
+void run(const char* name) {
+    Array arr(1);
+    double worst_ms{0};
+    Timer total{};
+    Timer timer{};
+    for (std::size_t i = 0; i < NUM; ++i) {
+        // only time pushes that may resize, timing every push costs more
+        // than the push itself
+        if (arr.length() == arr.capacity()) {
+            timer.reset();
+            arr.push(int(i));
+            double ms = timer.elapsed_ms();
+            worst_ms = (ms > worst_ms) ? ms : worst_ms;
+        } else {
+            arr.push(int(i));
+        }
+    }
+    double total_ms = total.elapsed_ms();
+
+    // read back to check elements survived growth
+    long long sum{0};
+    for (std::size_t i = 0; i < arr.length(); i += 4096) sum += arr[i];
+
+    std::cout << name << ": " << total_ms << " ms total, ";
+    std::cout << worst_ms << " ms worst push, checksum " << sum << std::endl;
+}
+
+int main() {
+    run<DynamicArray<int>>("DynamicArray, doubling");
+    run<SegmentedArray<int>>("SegmentedArray, 4K chunks");
+    run<SegmentedArray<int, 16>>("SegmentedArray, 64K chunks");
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+// @file         - ShardedBench.cpp
+// @brief        - Mixed 90% lookup, 10% update throughput of hash tables
+//                 behind one global mutex against sharded tables
+// @author       - Madhav Malhotra
+// @date         - 2024-01-01
+// @version      - 0.0.0
+// @note         - scaling is limited by the machine's core count
+// =============================================================================
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "./Timer.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/SeparateChaining.hpp"
+#include "../hashtable/ShardedHashTable.hpp"
+
+constexpr std::size_t KEYS = 1000000;
+constexpr std::size_t OPS = 8000000;
+
+// hash table behind one global mutex, the baseline being replaced
+template <typename Table, typename K, typename V>
+class LockedTable {
+    private:
+        std::mutex lock_{};
+        Table table_{};
+
+    public:
+        bool add(K key, V val) {
+            std::lock_guard<std::mutex> guard(this->lock_);
+            return this->table_.add(key, val);
+        }
+
+        bool remove(const K& key) {
+            std::lock_guard<std::mutex> guard(this->lock_);
+            return this->table_.remove(key);
+        }
+
+        V at(const K& key, bool& found) {
+            std::lock_guard<std::mutex> guard(this->lock_);
+            return this->table_.at(key, found);
+        }
+};
+
+// @brief           - splits OPS across threads, each 10th op adds or removes
+//                    a key in [KEYS, 2 * KEYS), the rest look up a key in
+//                    [0, 2 * KEYS). Returns elapsed ms.
+// @param table     - table prefilled with keys [0, KEYS)
+// @param threads   - number of worker threads
+template <typename Table>
+double run(Table& table, std::size_t threads) {
+    // lookups are summed so they can't be optimised out
+    std::atomic<std::size_t> total_hits{0};
+    Timer timer{};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&table, &total_hits, t, threads]() {
+            // xorshift, so key choice doesn't contend on a shared generator
+            std::uint64_t state = 0x9e3779b97f4a7c15ULL * (t + 1);
+            std::size_t hits{0};
+            for (std::size_t i = t; i < OPS; i += threads) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                long long key = (long long)(state % (2 * KEYS));
+
+                if (i % 10 == 0) {
+                    long long update = (long long)(KEYS + state % KEYS);
+                    if (!table.add(update, i)) table.remove(update);
+                } else {
+                    bool found = false;
+                    table.at(key, found);
+                    hits += found;
+                }
+            }
+            total_hits += hits;
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    return timer.elapsed_ms();
+}
+
+// @brief           - prefills a table, runs it at each thread count
+// @param name      - label of table
+template <typename Table>
+void scale(const char* name) {
+    std::cout << name << std::endl;
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        Table* table = new Table();
+        for (std::size_t i = 0; i < KEYS; ++i) table->add((long long)i, i);
+
+        double ms = run(*table, threads);
+        std::cout << "  " << threads << " threads: " << ms << " ms, ";
+        std::cout << double(OPS) / ms / 1000.0 << " M ops/s" << std::endl;
+        delete table;
+    }
+}
+
+int main() {
+    using K = long long;
+    using V = std::size_t;
+
+    scale<LockedTable<SC_HashTable<K,V>, K, V>>("SC_HashTable + mutex");
+    scale<LockedTable<LP_HashTable<K,V>, K, V>>("LP_HashTable + mutex");
+    scale<ShardedHashTable<K,V,SC_HashTable<K,V>>>("ShardedHashTable, 64 SC_HashTable shards");
+    scale<ShardedHashTable<K,V,LP_HashTable<K,V>>>("ShardedHashTable, 64 LP_HashTable shards");
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+// @file         - SimdBench.cpp
+// @brief        - Comparing vectorised search and reduction kernels against
+//                 element by element at() loops over DynamicArray<int>
+// @author       - Madhav Malhotra
+// @date         - 2023-12-25
+// @version      - 0.0.0
+// @note         - largest size allocates 400 MB
+// =============================================================================
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../array/SimdKernels.hpp"
+
+// @brief           - prints time and throughput of one run
+// @param name      - label of run
+// @param num       - elements scanned per repeat
+// @param reps      - number of repeats
+// @param ms        - elapsed milliseconds
+void report(const char* name, std::size_t num, std::size_t reps, double ms) {
+    std::cout << "  " << name << ": " << ms / reps << " ms, ";
+    std::cout << double(num) * reps / ms / 1000.0 << " M els/s" << std::endl;
+}
+
+// @brief           - times find (missing value, so full scan), count, min and sum
+// @param num       - number of elements
+void run_size(std::size_t num) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+    DynamicArray<int> arr(num);
+    for (std::size_t i = 0; i < num; ++i) arr.push(dist(gen));
+
+    // repeat small sizes so timings are measurable
+    std::size_t reps = (num < 1000000) ? 100000 : (num < 100000000) ? 20 : 2;
+    std::cout << num << " elements, " << reps << " repeats" << std::endl;
+    const int missing = -1;
+    long long sink{0};
+
+    Timer timer{};
+    for (std::size_t r = 0; r < reps; ++r) {
+        std::size_t idx = 0;
+        while (idx < arr.length() && arr.at(idx) != missing) ++idx;
+        sink += idx;
+    }
+    report("Find, at() loop", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        sink += SimdKernels::find(arr.data(), arr.length(), missing);
+    }
+    report("Find, kernel", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        for (std::size_t i = 0; i < arr.length(); ++i) sink += (arr.at(i) == 500000);
+    }
+    report("Count, at() loop", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        sink += SimdKernels::count(arr.data(), arr.length(), 500000);
+    }
+    report("Count, kernel", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        int lo = arr.at(0);
+        for (std::size_t i = 1; i < arr.length(); ++i) lo = (arr.at(i) < lo) ? arr.at(i) : lo;
+        sink += lo;
+    }
+    report("Min, at() loop", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        sink += SimdKernels::min(arr.data(), arr.length());
+    }
+    report("Min, kernel", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        for (std::size_t i = 0; i < arr.length(); ++i) sink += arr.at(i);
+    }
+    report("Sum, at() loop", num, reps, timer.elapsed_ms());
+
+    timer.reset();
+    for (std::size_t r = 0; r < reps; ++r) {
+        sink += SimdKernels::sum(arr.data(), arr.length());
+    }
+    report("Sum, kernel", num, reps, timer.elapsed_ms());
+
+    // keeps loops from being optimised away
+    std::cout << "  (checksum " << sink << ")" << std::endl;
+}
+
+int main() {
+    for (std::size_t num : {1000ul, 1000000ul, 100000000ul}) {
+        run_size(num);
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// @file         - SnapshotBench.cpp
+// @brief        - Time to get a large hash table serving lookups: rebuilding
+//                 it from its entries, loading a snapshot, or mapping one
+// @author       - Madhav Malhotra
+// @date         - 2024-01-05
+// @version      - 0.0.0
+// @note         - the snapshot was just written, so it's in the page cache.
+//                 Mapping a cold file instead pays disk reads per touched page.
+// =============================================================================
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include "./Timer.hpp"
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../hashtable/MappedTable.hpp"
+
+constexpr std::size_t NUM = 8000000;
+constexpr std::size_t LOOKUPS = 1000000;
+
+using K = long long;
+using V = std::size_t;
+using A = std::allocator<KeyValue<K,V>>;
+using Table = LP_HashTable<K,V,A,MixHash<K>,LinearProbe,MaskReduce>;
+using Mapped = LP_MappedTable<K,V,MixHash<K>,LinearProbe,MaskReduce>;
+
+// @brief           - times lookups of random stored keys
+// @param table     - table or mapped table holding keys
+// @param keys      - stored keys
+// @return          - elapsed ms
+template <typename T>
+double lookups(T& table, DynamicArray<K>& keys) {
+    std::mt19937_64 gen(3);
+    std::size_t hits{0};
+    Timer timer{};
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        bool found = false;
+        table.at(keys[gen() % NUM], found);
+        hits += found;
+    }
+    double ms = timer.elapsed_ms();
+    if (hits != LOOKUPS) std::cout << "missing keys: " << LOOKUPS - hits << std::endl;
+    return ms;
+}
+
+int main() {
+    const std::string path = "/tmp/SnapshotBench.bin";
+
+    std::mt19937_64 gen(7);
+    DynamicArray<K> keys(NUM);
+    for (std::size_t i = 0; i < NUM; ++i) keys.push((K)(gen() >> 1));
+
+    Timer timer{};
+    Table built{};
+    for (std::size_t i = 0; i < NUM; ++i) built.add(keys[i], i);
+    double build_ms = timer.elapsed_ms();
+
+    timer.reset();
+    built.save(path);
+    double save_ms = timer.elapsed_ms();
+    built.clear();
+
+    timer.reset();
+    Table loaded{};
+    loaded.load(path);
+    double load_ms = timer.elapsed_ms();
+    double loaded_ms = lookups(loaded, keys);
+    loaded.clear();
+
+    timer.reset();
+    Mapped verified(path);
+    double verify_ms = timer.elapsed_ms();
+
+    timer.reset();
+    Mapped mapped(path, false);
+    double map_ms = timer.elapsed_ms();
+    double mapped_ms = lookups(mapped, keys);
+
+    std::cout << NUM << " entries, " << mapped.capacity() << " buckets" << std::endl;
+    std::cout << "  rebuild with add: " << build_ms << " ms" << std::endl;
+    std::cout << "  save: " << save_ms << " ms" << std::endl;
+    std::cout << "  load: " << load_ms << " ms, then " << LOOKUPS << " lookups: ";
+    std::cout << loaded_ms << " ms" << std::endl;
+    std::cout << "  open_mapped, verified: " << verify_ms << " ms" << std::endl;
+    std::cout << "  open_mapped, unverified: " << map_ms << " ms, then " << LOOKUPS;
+    std::cout << " lookups: " << mapped_ms << " ms" << std::endl;
+
+    std::remove(path.c_str());
+    return 0;
+}
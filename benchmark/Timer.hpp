@@ -0,0 +1,37 @@
+// @file         - Timer.hpp
+// @brief        - Defining a stopwatch shared by the benchmarks
+// @author       - Madhav Malhotra
+// @date         - 2023-12-24
+// @version      - 0.0.0
+// =============================================================================
+
+#ifndef BENCHMARK_TIMER_HPP
+#define BENCHMARK_TIMER_HPP
+
+#include <chrono>
+
+class Timer {
+    private:
+        std::chrono::steady_clock::time_point start_{};
+
+    public:
+        // @brief           - starts timing on construction
+        Timer() {
+            this->reset();
+        }
+
+        // @brief           - restarts timing from now
+        void reset() {
+            this->start_ = std::chrono::steady_clock::now();
+        }
+
+        // @brief           - time since construction or last reset
+        // @return          - elapsed milliseconds
+        double elapsed_ms() {
+            std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - this->start_;
+            return elapsed.count();
+        }
+};
+
+#endif
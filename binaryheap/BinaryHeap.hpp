@@ -2,7 +2,11 @@
 // @brief        - Defining a binary heap using a binary tree
 // @author       - Madhav Malhotra
 // @date         - 2023-12-12
-// @version      - 0.0.0
+// @version      - 0.4.0
+// @since 0.3.0  - Bubbling swaps elements in place, push moves, emplace
+// @since 0.2.0  - Storage template parameter passed to binary tree
+// @since 0.1.0  - Growth policy template parameter passed to binary tree
+// @since 0.0.0  - Allocator template parameter passed to binary tree
 // =============================================================================
 
 #ifndef BINARYHEAP_HPP
@@ -10,36 +14,45 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include "../binarytree/BinaryTree.hpp"
 
 /* 
 Declare class
 */
 
-template <typename T>
-class BinaryHeap : public BinaryTree<T> {
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth,
+          typename Storage = DynamicArray<T, Alloc, Growth>>
+class BinaryHeap : public BinaryTree<T, Alloc, Growth, Storage> {
     private:
         bool max_heap_ = true;
 
         // @brief           - moves child element up a binary tree
-        // @param c_val     - child element value
         // @param c_idx     - child element index
         // @return          - index of added element
-        std::size_t bubble_up(T c_val, std::size_t c_idx);
+        std::size_t bubble_up(std::size_t c_idx);
 
         // @brief           - moves parent element down a binary tree
-        // @param p_val     - parent element value
         // @param p_idx     - parent element index
         // @return          - index of added element
-        std::size_t bubble_down(T p_val, std::size_t p_idx);
+        std::size_t bubble_down(std::size_t p_idx);
 
 
     public:
+        // inherit constructors to support custom allocators
+        using BinaryTree<T, Alloc, Growth, Storage>::BinaryTree;
+
         // @brief           - adds element and sorts to appropriate position
         // @param val       - element value
         // @return          - index of added element
         std::size_t push(T val);
 
+        // @brief           - constructs element in place and sorts it
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - index of added element
+        template <typename... Args>
+        std::size_t emplace(Args&&... args);
+
         // @brief           - removes node at specified index
         // @param idx       - index of node to remove
         // @return          - value at removed node
@@ -62,45 +75,34 @@ Define class - in hpp file due to template issues
 */
 
 // @brief           - moves child element up a binary tree
-// @param c_val     - child element value
 // @param c_idx     - child element index
 // @return          - final index of sorted child
-template <typename T>
-std::size_t BinaryHeap<T>::bubble_up(T c_val, std::size_t c_idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+std::size_t BinaryHeap<T,Alloc,Growth,Storage>::bubble_up(std::size_t c_idx) {
     int p_idx = this->parent(c_idx);
-    // prevent errors from root 
-    if (p_idx == -1) {
-        return c_idx;
-    }
 
-    T p = this->at(p_idx);
+    // bubble up, swapping so heavy values are never copied
+    while (p_idx != -1) {
+        T& p = this->at(p_idx);
+        T& c = this->at(c_idx);
+        if (!((this->max_heap_ && p<c) || (!this->max_heap_ && p>c))) break;
 
-    // bubble up
-    while ( (this->max_heap_ && p<c_val) || (!this->max_heap_ && p>c_val) ) {
-        // update vals
-        this->at(c_idx) = this->at(p_idx);
-        this->at(p_idx) = c_val;
+        using std::swap;
+        swap(p, c);
         
         // update indices
         c_idx = p_idx;
         p_idx = this->parent(c_idx);
-        
-        // prevent errors from root 
-        if (p_idx == -1) {
-            break;
-        }
-        p = this->at(p_idx);
     }
 
     return c_idx;
 }
 
 // @brief           - moves parent element down a binary tree
-// @param p_val     - parent element value
 // @param p_idx     - parent element index
 // @return          - final index of sorted parent
-template <typename T>
-std::size_t BinaryHeap<T>::bubble_down(T p_val, std::size_t p_idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+std::size_t BinaryHeap<T,Alloc,Growth,Storage>::bubble_down(std::size_t p_idx) {
     // Prep data
     int l_idx = this->left(p_idx);
     int r_idx = this->right(p_idx);
@@ -128,16 +130,18 @@ std::size_t BinaryHeap<T>::bubble_down(T p_val, std::size_t p_idx) {
             }
         }
         
+        T& p = this->at(p_idx);
+        T& sel = this->at(sel_idx);
         if (
             // stop if max and parent > child
-            (this->max_heap_ && p_val > this->at(sel_idx)) ||
+            (this->max_heap_ && p > sel) ||
             // or min and parent < child
-            (!this->max_heap_ && p_val < this->at(sel_idx)) 
+            (!this->max_heap_ && p < sel) 
         ) break;
 
         // update vals
-        this->at(p_idx) = this->at(sel_idx);
-        this->at(sel_idx) = p_val;
+        using std::swap;
+        swap(p, sel);
         p_idx = sel_idx;
         
         // update indices
@@ -154,30 +158,41 @@ std::size_t BinaryHeap<T>::bubble_down(T p_val, std::size_t p_idx) {
 // @brief           - adds element and sorts to appropriate position
 // @param val       - element value
 // @return          - index of added element
-template <typename T>
-std::size_t BinaryHeap<T>::push(T val) {
-    BinaryTree<T>::push(val);
+template <typename T, typename Alloc, typename Growth, typename Storage>
+std::size_t BinaryHeap<T,Alloc,Growth,Storage>::push(T val) {
+    BinaryTree<T, Alloc, Growth, Storage>::push(std::move(val));
+    std::size_t c_idx = this->count() - 1;
+    return this->bubble_up(c_idx);
+}
+
+// @brief           - constructs element in place and sorts it
+// @param args      - arguments forwarded to T's constructor
+// @return          - index of added element
+template <typename T, typename Alloc, typename Growth, typename Storage>
+template <typename... Args>
+std::size_t BinaryHeap<T,Alloc,Growth,Storage>::emplace(Args&&... args) {
+    this->emplace_back(std::forward<Args>(args)...);
     std::size_t c_idx = this->count() - 1;
-    return this->bubble_up(val, c_idx);
+    return this->bubble_up(c_idx);
 }
 
 // @brief           - removes node at specified index.
 // @param idx       - index of node to remove
 // @return          - value at removed node
-template <typename T>
-T BinaryHeap<T>::remove_by_index(std::size_t idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+T BinaryHeap<T,Alloc,Growth,Storage>::remove_by_index(std::size_t idx) {
     if (idx >= this->count()) {
         throw std::range_error("Input index out of range");
     }
 
-    T val = this->at(idx);
-    this->at(idx) = this->at(this->count() - 1);
+    std::size_t last = this->count() - 1;
+    T val = std::move(this->at(idx));
+    if (idx != last) this->at(idx) = std::move(this->at(last));
     this->pop();
     
     // bubbling, if els left to bubble
     if (idx < this->count()) {
-        this->bubble_up(this->at(idx), idx);
-        this->bubble_down(this->at(idx), idx);
+        this->bubble_down(this->bubble_up(idx));
     }
 
     return val;
@@ -2,16 +2,22 @@
 // @brief        - Defining a binary search tree using a node class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-15
-// @version      - 0.0.0
+// @version      - 0.2.0
+// @since 0.1.0  - Copy/move constructors and assignment, emplace, destructor.
+//                 Two child removal relinks nodes instead of copying values.
+// @since 0.0.0  - Removal scratch array kept inline instead of on the heap
 // =============================================================================
 
 #ifndef BINARYSEARCHTREENODE_HPP
 #define BINARYSEARCHTREENODE_HPP
 
 #include <cstddef>
+#include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
 #include "./BinarySearchTreeNode.hpp"
-#include "../array/DynamicArray.hpp"
+#include "../array/SmallDynamicArray.hpp"
 #include "../queue/Queue.hpp"
 
 /* 
@@ -25,9 +31,15 @@ class BinarySearchTree {
         std::size_t count_ = 0;
 
         // @brief           - adds node
-        // @param val       - value of node to add
-        // @param root      - value of node to add
-        void pushRecursive(T val, BSTNode<T>* root);
+        // @param val       - value of node to add, moved into new node
+        // @param root      - node position being considered
+        void pushRecursive(T& val, BSTNode<T>* root);
+
+        // @brief           - deep copies a subtree
+        // @param root      - pointer to root of subtree to copy
+        // @param parent    - parent of copied root
+        // @return          - pointer to root of copy
+        BSTNode<T>* clone(BSTNode<T>* root, BSTNode<T>* parent);
         
         // @brief           - finds min value in subtree
         // @param root      - pointer to root of subtree
@@ -43,6 +55,24 @@ class BinarySearchTree {
         void printBT(const std::string& prefix, BSTNode<T>* root, bool isLeft);
 
     public:
+        // @brief           - creates empty tree
+        BinarySearchTree() = default;
+
+        // @brief           - copies nodes of other tree, keeping its shape
+        BinarySearchTree(const BinarySearchTree<T>& other);
+
+        // @brief           - replaces nodes with copies of other tree's
+        BinarySearchTree<T>& operator=(const BinarySearchTree<T>& other);
+
+        // @brief           - takes other tree's nodes, leaving it empty
+        BinarySearchTree(BinarySearchTree<T>&& other) noexcept;
+
+        // @brief           - takes other tree's nodes, leaving it empty
+        BinarySearchTree<T>& operator=(BinarySearchTree<T>&& other) noexcept;
+
+        // @brief           - frees all nodes
+        ~BinarySearchTree();
+
         // @brief           - nicely prints the nodes of the tree
         void print();
 
@@ -62,6 +92,11 @@ class BinarySearchTree {
         // @brief           - adds node
         // @param val       - value of node to add
         void push(T val);
+
+        // @brief           - constructs value from args, then adds node
+        // @param args      - arguments forwarded to T's constructor
+        template <typename... Args>
+        void emplace(Args&&... args);
         
         // @brief           - removes root node
         // @return          - value at root node
@@ -74,9 +109,11 @@ class BinarySearchTree {
         // @param val       - val of node to remove
         // @param all       - whether to remove multiple reoccurrences
         // @return          - true if value removed, else false
-        bool remove_by_value(T val, bool all = false) {
+        bool remove_by_value(const T& val, bool all = false) {
+            if (this->root_ == nullptr) return false;
+
             // prep data for breadthwise search
-            DynamicArray<BSTNode<T>*> to_remove{};
+            SmallDynamicArray<BSTNode<T>*> to_remove{};
             Queue<BSTNode<T>*> to_check{};
             to_check.enqueue(this->root_);
 
@@ -99,7 +136,7 @@ class BinarySearchTree {
                 if (r) to_check.enqueue(r);
             }
 
-            // remove els
+            // remove els, removal only frees the node it's given
             for (std::size_t i = 0; i < to_remove.length(); ++i) {
                 this->remove(to_remove.at(i));
             }
@@ -122,41 +159,103 @@ BSTNode<T>* BinarySearchTree<T>::min(BSTNode<T>* root) {
 }
 
 // @brief           - adds node
-// @param val       - value of node to add
+// @param val       - value of node to add, moved into new node
 // @param root      - node position being considered
 template <typename T>
-void BinarySearchTree<T>::pushRecursive(T val, BSTNode<T>* root) {
-    T data = root->getData();
+void BinarySearchTree<T>::pushRecursive(T& val, BSTNode<T>* root) {
     BSTNode<T>* l = root->getLeft();
     BSTNode<T>* r = root->getRight();
     
-    if (val <= data) {
+    if (val <= root->getData()) {
         if (l) this->pushRecursive(val, l);
         else {
-            BSTNode<T>* node = new BSTNode<T>{};
-            node->setData(val);
+            BSTNode<T>* node = new BSTNode<T>(std::move(val));
             root->setLeft(node);
             node->setParent(root);
         }
     } else {
         if (r) this->pushRecursive(val, r);
         else {
-            BSTNode<T>* node = new BSTNode<T>{};
-            node->setData(val);
+            BSTNode<T>* node = new BSTNode<T>(std::move(val));
             root->setRight(node);
             node->setParent(root);
         }
     }
 }
 
+// @brief           - deep copies a subtree
+// @param root      - pointer to root of subtree to copy
+// @param parent    - parent of copied root
+// @return          - pointer to root of copy
+template <typename T>
+BSTNode<T>* BinarySearchTree<T>::clone(BSTNode<T>* root, BSTNode<T>* parent) {
+    if (root == nullptr) return nullptr;
+
+    BSTNode<T>* node = new BSTNode<T>(root->getData());
+    node->setParent(parent);
+    try {
+        node->setLeft(this->clone(root->getLeft(), node));
+        node->setRight(this->clone(root->getRight(), node));
+    } catch (...) {
+        // free the partial copy below this node, then this node
+        BinarySearchTree<T> partial{};
+        partial.root_ = node;
+        partial.clear();
+        throw;
+    }
+    return node;
+}
+
+// @brief           - copies nodes of other tree, keeping its shape
+template <typename T>
+BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree<T>& other) {
+    this->root_ = this->clone(other.root_, nullptr);
+    this->count_ = other.count_;
+}
+
+// @brief           - replaces nodes with copies of other tree's
+template <typename T>
+BinarySearchTree<T>& BinarySearchTree<T>::operator=(const BinarySearchTree<T>& other) {
+    if (this != &other) {
+        // copy first so this tree is untouched if copying throws
+        BinarySearchTree<T> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// @brief           - takes other tree's nodes, leaving it empty
+template <typename T>
+BinarySearchTree<T>::BinarySearchTree(BinarySearchTree<T>&& other) noexcept
+    : root_(other.root_), count_(other.count_) {
+    other.root_ = nullptr;
+    other.count_ = 0;
+}
+
+// @brief           - takes other tree's nodes, leaving it empty
+template <typename T>
+BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree<T>&& other) noexcept {
+    if (this != &other) {
+        this->clear();
+        std::swap(this->root_, other.root_);
+        std::swap(this->count_, other.count_);
+    }
+    return *this;
+}
+
+// @brief           - frees all nodes
+template <typename T>
+BinarySearchTree<T>::~BinarySearchTree() {
+    this->clear();
+}
+
 // @brief          - adds node
 // @param val      - value of new node
 template <typename T>
 void BinarySearchTree<T>::push(T val) {
     // handle empty tree
     if (this->root_ == nullptr) {
-        this->root_ = new BSTNode<T>{};
-        this->root_->setData(val);
+        this->root_ = new BSTNode<T>(std::move(val));
     } else {
         this->pushRecursive(val, this->root_);
     }
@@ -164,6 +263,15 @@ void BinarySearchTree<T>::push(T val) {
     ++this->count_;
 }
 
+// @brief           - constructs value from args, then adds node
+// @param args      - arguments forwarded to T's constructor
+template <typename T>
+template <typename... Args>
+void BinarySearchTree<T>::emplace(Args&&... args) {
+    // value is needed for comparisons before a node exists for it
+    this->push(T(std::forward<Args>(args)...));
+}
+
 // @brief           - removes node at specified memory address
 // @param node      - pointer to specified node
 template <typename T>
@@ -177,16 +285,38 @@ void BinarySearchTree<T>::remove(BSTNode<T>* node) {
         // check for parent to avoid bugs from singleton tree
         if (p) {
             (p->getLeft() == node) ? p->setLeft(nullptr) : p->setRight(nullptr);
+        } else {
+            // only node, tree is now empty
+            this->root_ = nullptr;
         }
         delete node;
         --this->count_;
     }
     // both subtrees
     else if (l && r) {
-        // remove min node in right subtree (NOT always a leaf)
+        // relink min node in right subtree (NOT always a leaf) into this
+        // node's place. Copying its value up instead would free the min node,
+        // which callers may still hold, e.g. remove_by_value with all = true.
         BSTNode<T>* min = this->min(r);
-        node->setData(min->getData());
-        this->remove(min);
+        if (min != r) {
+            BSTNode<T>* min_p = min->getParent();
+            BSTNode<T>* min_r = min->getRight();
+            min_p->setLeft(min_r);
+            if (min_r) min_r->setParent(min_p);
+            min->setRight(r);
+            r->setParent(min);
+        }
+        min->setLeft(l);
+        l->setParent(min);
+        min->setParent(p);
+
+        if (p) {
+            (p->getLeft() == node) ? p->setLeft(min) : p->setRight(min);
+        } else {
+            this->root_ = min;
+        }
+        delete node;
+        --this->count_;
         min = nullptr;
     }
     // single subtree
@@ -218,6 +348,9 @@ void BinarySearchTree<T>::remove(BSTNode<T>* node) {
 // @return          - value at root node
 template <typename T>
 void BinarySearchTree<T>::poll() {
+    if (this->root_ == nullptr) {
+        throw std::range_error("Cannot poll from empty tree");
+    }
     this->remove(this->root_);
 }
 
@@ -225,7 +358,7 @@ void BinarySearchTree<T>::poll() {
 template <typename T>
 void BinarySearchTree<T>::clear() {
     Queue<BSTNode<T>*> to_clear{};
-    to_clear.enqueue(this->root_);
+    if (this->root_) to_clear.enqueue(this->root_);
 
     while (to_clear.length()) {
         BSTNode<T>* p = to_clear.dequeue();
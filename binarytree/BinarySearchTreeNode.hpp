@@ -2,13 +2,16 @@
 // @brief        - Declaring a node class for a binary search tree
 // @author       - Madhav Malhotra
 // @date         - 2023-12-15
-// @version      - 0.0.0
+// @version      - 0.1.0
+// @since 0.0.0  - Data moved in, returned by reference, or built in place
 // =======================================================================================
 
 
 #ifndef BSTNode_HPP
 #define BSTNode_HPP
 
+#include <utility>
+
 /*
 Declare Node class members
 */
@@ -27,17 +30,21 @@ class BSTNode {
         BSTNode<T>* setRight(BSTNode<T>* right);
         BSTNode<T>* setParent(BSTNode<T>* parent);
 
-        T getData();
+        T& getData();
         BSTNode<T>* getLeft();
         BSTNode<T>* getRight();
         BSTNode<T>* getParent();
 
         // Cannot define externally while keeping default template type
-        BSTNode(T data = T{}) {
-            this->data_ = data;
+        BSTNode(T data = T{}) : data_(std::move(data)) {
             this->left_ = nullptr;
             this->right_ = nullptr;
         }
+
+        // @brief           - constructs data in place from args
+        // @param args      - arguments forwarded to T's constructor
+        template <typename... Args>
+        explicit BSTNode(std::in_place_t, Args&&... args) : data_(std::forward<Args>(args)...) {}
 };
 
 
@@ -49,7 +56,7 @@ Define Node class members
 // @param T data    - new value
 template <typename T>
 void BSTNode<T>::setData(T data) {
-    this->data_ = data;
+    this->data_ = std::move(data);
 }
 
 // @brief           - updates left child node
@@ -82,9 +89,9 @@ BSTNode<T>* BSTNode<T>::setParent(BSTNode<T>* parent) {
     return prev; // CLASS USERS HANDLE MEMORY DEALLOCATION
 }
 
-// @brief            - get node data
+// @brief            - get node data, by reference to avoid copies
 template <typename T>
-T BSTNode<T>::getData() {
+T& BSTNode<T>::getData() {
     return this->data_;
 }
 
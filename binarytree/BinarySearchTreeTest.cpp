@@ -43,6 +43,26 @@ int main() {
     std::cout << "Size after: " << bt_test.count() << std::endl;
     bt_test.print();
 
+    // copy, move and emplace
+    BinarySearchTree<int> bt_copy(bt_test);
+    bt_copy.emplace(24);
+    bt_copy.emplace(24);
+    bt_copy.remove_by_value(24, true);
+    BinarySearchTree<int> bt_moved(std::move(bt_copy));
+    std::cout << "Copy size: " << bt_moved.count();
+    std::cout << ", moved from size: " << bt_copy.count() << std::endl;
+
+    // emptying a tree by removal, then destroying it
+    {
+        BinarySearchTree<int> bt_single{};
+        bt_single.push(1);
+        bt_single.remove_by_value(1);
+        std::cout << "Emptied: " << bt_single.count() << " " << (bt_single.root() == nullptr) << std::endl;
+        bt_single.push(2);
+        bt_single.poll();
+        std::cout << "Polled: " << bt_single.count() << " " << (bt_single.root() == nullptr) << std::endl;
+    }
+
     // clear
     bt_test.clear();
     std::cout << "Cleared: " << bt_test.count() << std::endl;
@@ -2,7 +2,13 @@
 // @brief        - Defining a binary tree using a dynamic array
 // @author       - Madhav Malhotra
 // @date         - 2023-12-11
-// @version      - 0.2.1
+// @version      - 0.7.0
+// @since 0.6.0  - .remove_by_index() moves values instead of copying
+// @since 0.5.0  - Storage template parameter, e.g. a segmented array whose
+//                 growth never moves nodes
+// @since 0.4.0  - .remove_by_value() scans with vectorised kernels
+// @since 0.3.0  - Growth policy template parameter passed to dynamic array
+// @since 0.2.1  - Allocator template parameter passed to dynamic array
 // @since 0.2.0  - Bug patch in .remove_by_value() with all = true.
 // @since 0.1.0  - Made .remove_by_index() virtual for binary heap derived class
 // @since 0.0.0  - Added pretty print utility
@@ -12,15 +18,19 @@
 #define BINARYTREEARRAY_HPP
 
 #include <cstddef>
+#include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 #include "../array/DynamicArray.hpp"
 
 /* 
 Declare class
 */
 
-template <typename T>
-class BinaryTree : public DynamicArray<T> {
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth,
+          typename Storage = DynamicArray<T, Alloc, Growth>>
+class BinaryTree : public Storage {
     private:
         // @brief           - Shows the nodes of the binary tree
         // @param prefix    - levels/sublevels on each line
@@ -31,13 +41,16 @@ class BinaryTree : public DynamicArray<T> {
         void printBT(const std::string& prefix, const std::size_t idx, bool isLeft);
 
     public:
+        // inherit constructors to support custom allocators
+        using Storage::Storage;
+
         // @brief           - nicely prints the nodes of the tree
         void print();
 
         // @brief           - alias for dynamic array length
         // @return          - number of nodes in binary tree
         std::size_t count() {
-            return DynamicArray<T>::length();
+            return Storage::length();
         }
 
         // @brief           - finds left child of input node
@@ -69,27 +82,20 @@ class BinaryTree : public DynamicArray<T> {
         // @param val       - val of node to remove
         // @param all       - whether to remove multiple reoccurrences
         // @return          - true if value removed, else false
-        bool remove_by_value(T val, bool all = false) {
-            std::size_t len = this->count();
+        bool remove_by_value(const T& val, bool all = false) {
             bool found = false;
 
-            // stop loop upon el removal to avoid out of range
-            for (std::size_t i = 0; i < len; ++i) {
-                if (this->at(i) == val) {
-                    this->remove_by_index(i);
-                    found = true;
-                    break;
-                }
+            // scan restarts from the front after each removal,
+            // since remove_by_index may reorder the remaining nodes
+            std::size_t idx = this->find(val);
+            while (idx < this->count()) {
+                this->remove_by_index(idx);
+                found = true;
+                if (!all) break;
+                idx = this->find(val);
             }
 
-            // only runs the function again if early stop above
-            if (all && found) {
-                // DO NOT SWITCH ORDER OF OR. COMPILER WILL OPTIMISE TO JUST
-                // RETURN FOUND WITHOUT RECURSIVE CALL
-                return this->remove_by_value(val, true) || found;
-            } else {
-                return found;
-            }
+            return found;
         }
 };
 
@@ -101,8 +107,8 @@ Define class - in hpp file due to template issues
 // @brief           - finds left child of input node
 // @param idx       - index of input node
 // @return          - index of left child if it exists, else -1
-template <typename T>
-int BinaryTree<T>::left(std::size_t idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+int BinaryTree<T,Alloc,Growth,Storage>::left(std::size_t idx) {
     std::size_t l_idx = 2*idx + 1;
     return (l_idx < this->count()) ? l_idx : -1;
 };
@@ -110,8 +116,8 @@ int BinaryTree<T>::left(std::size_t idx) {
 // @brief           - finds right child of input node
 // @param idx       - index of input node
 // @return          - index of right child if it exists, else -1
-template <typename T>
-int BinaryTree<T>::right(std::size_t idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+int BinaryTree<T,Alloc,Growth,Storage>::right(std::size_t idx) {
     std::size_t r_idx = 2*idx + 2;
     return (r_idx < this->count()) ? r_idx : -1;
 }
@@ -119,8 +125,8 @@ int BinaryTree<T>::right(std::size_t idx) {
 // @brief           - finds parent of input node
 // @param idx       - index of input node
 // @return          - index of parent if it exists, else -1
-template <typename T>
-int BinaryTree<T>::parent(std::size_t idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+int BinaryTree<T,Alloc,Growth,Storage>::parent(std::size_t idx) {
     int p_idx = (idx % 2) ? (idx-1)/2 : (idx-2)/2;
     return (p_idx > -1 && idx > 0) ? p_idx : -1;
 }
@@ -129,22 +135,23 @@ int BinaryTree<T>::parent(std::size_t idx) {
 // @param idx       - index of node to remove
 // @return          - value at removed node
 // @note            - this is not binary SEARCH tree behaviour.
-template <typename T>
-T BinaryTree<T>::remove_by_index(std::size_t idx) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+T BinaryTree<T,Alloc,Growth,Storage>::remove_by_index(std::size_t idx) {
     if (idx >= this->count()) {
         throw std::out_of_range("Index must be less than list length");
     }
 
-    T temp = T{this->at(idx)};
-    this->at(idx) = this->at(this->count() - 1);
+    std::size_t last = this->count() - 1;
+    T temp = std::move(this->at(idx));
+    if (idx != last) this->at(idx) = std::move(this->at(last));
     this->pop();
     return temp;
 }
 
 // @brief           - removes root node
 // @return          - value at root node
-template <typename T>
-T BinaryTree<T>::poll() {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+T BinaryTree<T,Alloc,Growth,Storage>::poll() {
     return this->remove_by_index(0);
 }
 
@@ -159,8 +166,8 @@ Pretty print utility - https://stackoverflow.com/a/51730733
 // @param isleft    - left or right node
 // @author          - Vasili Novikov, translated by Adrian Schneider
 // @source          - https://stackoverflow.com/a/51730733
-template <typename T>
-void BinaryTree<T>::printBT(const std::string& prefix, const std::size_t idx, bool isLeft) {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+void BinaryTree<T,Alloc,Growth,Storage>::printBT(const std::string& prefix, const std::size_t idx, bool isLeft) {
     if ( idx < this->count() ) {
         // print current line
         std::cout << prefix;
@@ -174,8 +181,8 @@ void BinaryTree<T>::printBT(const std::string& prefix, const std::size_t idx, bo
 }
 
 // @brief           - Shows the nodes of the binary tree
-template <typename T>
-void BinaryTree<T>::print() {
+template <typename T, typename Alloc, typename Growth, typename Storage>
+void BinaryTree<T,Alloc,Growth,Storage>::print() {
     this->printBT("", 0, false);
 }
 
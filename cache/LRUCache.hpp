@@ -0,0 +1,413 @@
+// @file         LRUCache.hpp
+// @brief        Defining a bounded least recently used cache over a hash
+//               table of doubly linked nodes
+// @author       Madhav Malhotra
+// @date         2024-01-08
+// @version      0.0.0
+// =============================================================================
+
+#ifndef CACHE_LRU_CACHE_HPP
+#define CACHE_LRU_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "../array/DynamicArray.hpp"
+#include "../hashtable/HashPolicies.hpp"
+#include "../hashtable/KeyValue.hpp"
+#include "../hashtable/LinearProbing.hpp"
+#include "../linkedlist/DoublyLinkedNode.hpp"
+
+// Bytes an entry is charged against a byte budget, its key and value
+// themselves. Replace it to also count memory they own, e.g. string contents.
+struct EntryBytes {
+    template <typename K, typename V>
+    std::size_t operator()(const K& key, const V& val) const {
+        return sizeof(key) + sizeof(val);
+    }
+};
+
+/*
+Declare class
+*/
+
+// Entries live in DLNodes linked from most to least recently used, and an
+// LP_HashTable maps keys to their nodes, so get, put and evict are O(1).
+// Every node is allocated up front in one pool, and the table is reserved
+// for capacity keys, so nothing allocates after construction unless keys
+// or values do. DLList isn't used since it frees nodes with delete, the
+// cache relinks pool nodes itself.
+// Expiry is lazy, an expired entry is dropped by the lookup that finds it,
+// or evicted like any other once it's least recently used.
+// Hash  - mixing hasher, Hash{}(key). The table reduces with its low bits.
+// Size  - bytes charged per entry, Size{}(key, val), e.g. EntryBytes
+// Clock - time source of expiry, with now(), time_point and duration
+template <typename K, typename V, typename Hash = MixHash<K>, typename Size = EntryBytes,
+          typename Clock = std::chrono::steady_clock>
+class LRUCache {
+    public:
+        using Duration = typename Clock::duration;
+
+    private:
+        struct Entry {
+            K key{};
+            V val{};
+            std::size_t bytes{};
+            typename Clock::time_point expires{};
+        };
+
+        using Node = DLNode<Entry>;
+        using Map = LP_HashTable<K, Node*, std::allocator<KeyValue<K, Node*>>, Hash, LinearProbe, MaskReduce>;
+
+        DynamicArray<Node> pool_;
+        Map map_{};
+        Node* head_{};                  // most recently used
+        Node* tail_{};                  // least recently used, evicted first
+        Node* free_{};                  // unused nodes, linked by next
+        std::size_t capacity_{};
+        std::size_t max_bytes_{};
+        std::size_t bytes_{};
+        Duration ttl_{};
+
+        std::size_t hits_{};
+        std::size_t misses_{};
+        std::size_t evictions_{};
+        std::size_t expirations_{};
+
+        // @brief           detaches node from the recency list
+        // @param node      linked node
+        void unlink(Node* node);
+
+        // @brief           attaches node as most recently used
+        // @param node      unlinked node
+        void link_front(Node* node);
+
+        // @brief           removes node's entry and returns node to the pool
+        // @param node      linked node
+        void release(Node* node);
+
+    public:
+        // @brief           creates empty cache, allocating every node
+        // @param capacity  max number of entries, > 0
+        // @param max_bytes max total Size of entries, 0 for no byte budget
+        // @param ttl       time an entry stays valid after its put, zero
+        //                  for no expiry
+        LRUCache(std::size_t capacity = 64, std::size_t max_bytes = 0, Duration ttl = Duration::zero());
+
+        // nodes point at each other, so copies would need relinking
+        LRUCache(const LRUCache<K,V,Hash,Size,Clock>& other) = delete;
+        LRUCache<K,V,Hash,Size,Clock>& operator=(const LRUCache<K,V,Hash,Size,Clock>& other) = delete;
+
+        // @brief           takes other cache's pool, nodes don't move.
+        //                  Other is left empty and can't be used until
+        //                  assigned to.
+        LRUCache(LRUCache<K,V,Hash,Size,Clock>&& other);
+        LRUCache<K,V,Hash,Size,Clock>& operator=(LRUCache<K,V,Hash,Size,Clock>&& other);
+
+        // @brief           get count
+        // @return          number of entries, expired ones included
+        std::size_t count();
+
+        // @brief           get capacity
+        // @return          max number of entries
+        std::size_t capacity();
+
+        // @brief           get bytes
+        // @return          total Size of entries
+        std::size_t bytes();
+
+        // @brief           get byte budget
+        // @return          max total Size of entries, 0 if unlimited
+        std::size_t max_bytes();
+
+        // @brief           get hits
+        // @return          lookups that found a live entry
+        std::size_t hits();
+
+        // @brief           get misses
+        // @return          lookups that found no entry or an expired one
+        std::size_t misses();
+
+        // @brief           get evictions
+        // @return          entries dropped to make room
+        std::size_t evictions();
+
+        // @brief           get expirations
+        // @return          expired entries dropped by lookups
+        std::size_t expirations();
+
+        // @brief           adds or replaces the entry of a key as most
+        //                  recently used, evicting least recently used
+        //                  entries until it fits
+        // @param key       key of entry
+        // @param val       value of entry
+        // @return          false if the entry alone exceeds the byte budget,
+        //                  it isn't stored and any old entry of key is removed
+        bool put(K key, V val);
+
+        // @brief           find value stored at specified key, marking it
+        //                  most recently used
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found
+        //                  or expired. Invalidated by later puts and removals.
+        V* find(const K& key);
+
+        // @brief           access value stored at specified key, marking it
+        //                  most recently used
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           removes the entry of a key
+        // @param key       key to remove
+        // @return          false if key not found
+        bool remove(const K& key);
+
+        // @brief           removes every entry, keeping nodes and counters
+        void clear();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates empty cache, allocating every node
+// @param capacity  max number of entries, > 0
+// @param max_bytes max total Size of entries, 0 for no byte budget
+// @param ttl       time an entry stays valid after its put, zero for none
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+LRUCache<K,V,Hash,Size,Clock>::LRUCache(std::size_t capacity, std::size_t max_bytes, Duration ttl)
+    : pool_(std::size_t(1)), capacity_(capacity), max_bytes_(max_bytes), ttl_(ttl) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+    this->pool_.resize(capacity, Node{});
+    this->map_.reserve(capacity);
+
+    for (std::size_t i = 0; i < capacity; ++i) {
+        this->pool_[i].setNext(this->free_);
+        this->free_ = &this->pool_[i];
+    }
+}
+
+// @brief           takes other cache's pool, nodes don't move
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+LRUCache<K,V,Hash,Size,Clock>::LRUCache(LRUCache<K,V,Hash,Size,Clock>&& other)
+    : pool_(std::move(other.pool_)), map_(std::move(other.map_)),
+      head_(std::exchange(other.head_, nullptr)), tail_(std::exchange(other.tail_, nullptr)),
+      free_(std::exchange(other.free_, nullptr)), capacity_(std::exchange(other.capacity_, 0)),
+      max_bytes_(other.max_bytes_), bytes_(std::exchange(other.bytes_, 0)), ttl_(other.ttl_),
+      hits_(other.hits_), misses_(other.misses_), evictions_(other.evictions_),
+      expirations_(other.expirations_) {}
+
+// @brief           takes other cache's pool, nodes don't move
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+LRUCache<K,V,Hash,Size,Clock>& LRUCache<K,V,Hash,Size,Clock>::operator=(LRUCache<K,V,Hash,Size,Clock>&& other) {
+    if (this != &other) {
+        this->pool_ = std::move(other.pool_);
+        this->map_ = std::move(other.map_);
+        this->head_ = std::exchange(other.head_, nullptr);
+        this->tail_ = std::exchange(other.tail_, nullptr);
+        this->free_ = std::exchange(other.free_, nullptr);
+        this->capacity_ = std::exchange(other.capacity_, 0);
+        this->max_bytes_ = other.max_bytes_;
+        this->bytes_ = std::exchange(other.bytes_, 0);
+        this->ttl_ = other.ttl_;
+        this->hits_ = other.hits_;
+        this->misses_ = other.misses_;
+        this->evictions_ = other.evictions_;
+        this->expirations_ = other.expirations_;
+    }
+    return *this;
+}
+
+// Getters.
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::count() {
+    return this->map_.count();
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::capacity() {
+    return this->capacity_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::bytes() {
+    return this->bytes_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::max_bytes() {
+    return this->max_bytes_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::hits() {
+    return this->hits_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::misses() {
+    return this->misses_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::evictions() {
+    return this->evictions_;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+std::size_t LRUCache<K,V,Hash,Size,Clock>::expirations() {
+    return this->expirations_;
+}
+
+// @brief           detaches node from the recency list
+// @param node      linked node
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+void LRUCache<K,V,Hash,Size,Clock>::unlink(Node* node) {
+    Node* last = node->getLast();
+    Node* next = node->getNext();
+    if (last) last->setNext(next);
+    else this->head_ = next;
+    if (next) next->setLast(last);
+    else this->tail_ = last;
+}
+
+// @brief           attaches node as most recently used
+// @param node      unlinked node
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+void LRUCache<K,V,Hash,Size,Clock>::link_front(Node* node) {
+    node->setLast(nullptr);
+    node->setNext(this->head_);
+    if (this->head_) this->head_->setLast(node);
+    else this->tail_ = node;
+    this->head_ = node;
+}
+
+// @brief           removes node's entry and returns node to the pool
+// @param node      linked node
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+void LRUCache<K,V,Hash,Size,Clock>::release(Node* node) {
+    Entry& entry = node->getData();
+    this->unlink(node);
+    this->map_.remove(entry.key);
+    this->bytes_ -= entry.bytes;
+
+    // drop what the entry owns now rather than when the node is reused
+    entry = Entry{};
+    node->setNext(this->free_);
+    this->free_ = node;
+}
+
+// @brief           adds or replaces the entry of a key as most recently used
+// @param key       key of entry
+// @param val       value of entry
+// @return          false if the entry alone exceeds the byte budget
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+bool LRUCache<K,V,Hash,Size,Clock>::put(K key, V val) {
+    std::size_t bytes = Size{}(key, val);
+    Node** p_node = this->map_.find(key);
+    if (this->max_bytes_ && bytes > this->max_bytes_) {
+        if (p_node) this->release(*p_node);
+        return false;
+    }
+
+    // a replaced entry keeps its node, the rest are evicted around it
+    Node* node = nullptr;
+    if (p_node) {
+        node = *p_node;
+        this->unlink(node);
+        this->bytes_ -= node->getData().bytes;
+        node->getData().bytes = 0;
+    }
+    while ((!node && this->map_.count() >= this->capacity_) ||
+           (this->max_bytes_ && this->bytes_ + bytes > this->max_bytes_)) {
+        this->release(this->tail_);
+        ++this->evictions_;
+    }
+
+    if (!node) {
+        node = this->free_;
+        this->free_ = node->getNext();
+        node->getData().key = key;
+        try {
+            this->map_.add(std::move(key), node);
+        } catch (...) {
+            node->getData() = Entry{};
+            this->free_ = node;
+            throw;
+        }
+    }
+
+    Entry& entry = node->getData();
+    entry.val = std::move(val);
+    entry.bytes = bytes;
+    if (this->ttl_ != Duration::zero()) entry.expires = Clock::now() + this->ttl_;
+    this->bytes_ += bytes;
+    this->link_front(node);
+    return true;
+}
+
+// @brief           find value stored at specified key, marking it most
+//                  recently used
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found or expired
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+V* LRUCache<K,V,Hash,Size,Clock>::find(const K& key) {
+    Node** p_node = this->map_.find(key);
+    if (!p_node) {
+        ++this->misses_;
+        return nullptr;
+    }
+
+    Node* node = *p_node;
+    if (this->ttl_ != Duration::zero() && Clock::now() >= node->getData().expires) {
+        this->release(node);
+        ++this->expirations_;
+        ++this->misses_;
+        return nullptr;
+    }
+
+    ++this->hits_;
+    if (node != this->head_) {
+        this->unlink(node);
+        this->link_front(node);
+    }
+    return &node->getData().val;
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+V LRUCache<K,V,Hash,Size,Clock>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           removes the entry of a key
+// @param key       key to remove
+// @return          false if key not found
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+bool LRUCache<K,V,Hash,Size,Clock>::remove(const K& key) {
+    Node** p_node = this->map_.find(key);
+    if (!p_node) return false;
+    this->release(*p_node);
+    return true;
+}
+
+// @brief           removes every entry, keeping nodes and counters
+template <typename K, typename V, typename Hash, typename Size, typename Clock>
+void LRUCache<K,V,Hash,Size,Clock>::clear() {
+    while (this->tail_) this->release(this->tail_);
+}
+
+#endif
@@ -0,0 +1,124 @@
+// @file         - LRUCacheTest.cpp
+// @brief        - Testing a bounded LRU cache with byte budgets and expiry
+// @author       - Madhav Malhotra
+// @date         - 2024-01-08
+// @version      - 0.0.0
+// =============================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "./LRUCache.hpp"
+
+// counts heap allocations, to check the cache doesn't make any once built
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t bytes) {
+    ++allocations;
+    if (void* p = std::malloc(bytes ? bytes : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// time set by hand, so expiry is tested without sleeping
+struct TestClock {
+    using rep = long long;
+    using period = std::milli;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<TestClock>;
+    static constexpr bool is_steady = true;
+
+    static inline rep ticks = 0;
+
+    static time_point now() {
+        return time_point(duration(ticks));
+    }
+};
+
+// charges string values by their length
+struct StringBytes {
+    std::size_t operator()(int, const std::string& val) const {
+        return val.size();
+    }
+};
+
+int main() {
+    // Test eviction of the least recently used entry
+    LRUCache<int, int> cache(3);
+    for (int i = 0; i < 3; ++i) cache.put(i, i * 10);
+    bool found = false;
+    std::cout << "Get 0: " << cache.at(0, found) << " " << found << std::endl;
+    cache.put(3, 30);
+    std::cout << "After put 3, has 1: " << (cache.find(1) != nullptr);
+    std::cout << ", has 0: " << (cache.find(0) != nullptr) << ", count: " << cache.count() << std::endl;
+
+    // replacing a value refreshes it, so 2 is evicted next
+    cache.put(3, 33);
+    cache.put(0, 1);
+    cache.put(4, 40);
+    std::cout << "Replaced 3: " << *cache.find(3) << ", has 2: " << (cache.find(2) != nullptr) << std::endl;
+    std::cout << "Hits: " << cache.hits() << ", misses: " << cache.misses();
+    std::cout << ", evictions: " << cache.evictions() << std::endl;
+
+    std::cout << "Removed: " << cache.remove(3) << " " << cache.remove(3);
+    std::cout << ", count: " << cache.count() << std::endl;
+
+    // Test steady state operation never allocates
+    LRUCache<int, int> hot(1000);
+    for (int i = 0; i < 1000; ++i) hot.put(i, i);
+    std::size_t before = allocations;
+    for (int i = 0; i < 100000; ++i) {
+        int key = (i * 7919) % 3000;
+        if (!hot.find(key)) hot.put(key, i);
+        if (i % 100 == 0) hot.remove(key);
+    }
+    std::cout << "Allocations in steady state: " << allocations - before;
+    std::cout << ", count: " << hot.count() << std::endl;
+
+    // Test byte budget, larger values evict more entries
+    LRUCache<int, std::string, MixHash<int>, StringBytes> sized(100, 10);
+    sized.put(1, "aaaa");
+    sized.put(2, "bbbb");
+    sized.put(3, "cccccc");
+    std::cout << "Bytes: " << sized.bytes() << ", count: " << sized.count();
+    std::cout << ", has 1: " << (sized.find(1) != nullptr) << std::endl;
+    std::cout << "Too large stored: " << sized.put(2, "dddddddddddd") << ", has 2: ";
+    std::cout << (sized.find(2) != nullptr) << ", bytes: " << sized.bytes() << std::endl;
+
+    // Test expiry, entries live for ttl after their put
+    LRUCache<int, int, MixHash<int>, EntryBytes, TestClock> timed(10, 0, TestClock::duration(100));
+    timed.put(1, 1);
+    TestClock::ticks = 60;
+    timed.put(2, 2);
+    timed.find(1);
+    TestClock::ticks = 120;
+    std::cout << "At 120ms, has 1: " << (timed.find(1) != nullptr);
+    std::cout << ", has 2: " << (timed.find(2) != nullptr);
+    std::cout << ", expirations: " << timed.expirations() << ", count: " << timed.count() << std::endl;
+
+    // Test moving and clearing
+    LRUCache<int, int> moved(std::move(cache));
+    std::cout << "Moved count: " << moved.count() << ", hits: " << moved.hits() << std::endl;
+    moved.clear();
+    moved.put(9, 9);
+    std::cout << "Cleared then put: " << moved.count() << " " << *moved.find(9) << std::endl;
+
+    try {
+        LRUCache<int, int> empty(0);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
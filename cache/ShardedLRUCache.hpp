@@ -0,0 +1,264 @@
+// @file         ShardedLRUCache.hpp
+// @brief        Defining a thread safe LRU cache that stripes keys across
+//               independently locked LRUCache shards
+// @author       Madhav Malhotra
+// @date         2024-01-08
+// @version      0.0.0
+// @note         Recency is kept per shard, so the entry evicted is the least
+//               recently used of its shard, not of the whole cache.
+// =============================================================================
+
+#ifndef CACHE_SHARDED_LRU_CACHE_HPP
+#define CACHE_SHARDED_LRU_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "./LRUCache.hpp"
+#include "../hashtable/HashPolicies.hpp"
+
+/*
+Declare class
+*/
+
+// Every lookup moves its entry to the front of a list, so unlike
+// ShardedHashTable, readers take their shard's lock exclusively. Capacity
+// and byte budget are split evenly between shards.
+// ShardBits - log2 of the number of shards
+template <typename K, typename V, typename Hash = MixHash<K>, typename Size = EntryBytes,
+          typename Clock = std::chrono::steady_clock, std::size_t ShardBits = 4>
+class ShardedLRUCache {
+    static_assert(ShardBits > 0 && ShardBits < 16, "ShardedLRUCache requires 1 to 15 shard bits");
+
+    public:
+        using Duration = typename Clock::duration;
+
+    private:
+        static constexpr std::size_t SHARDS = std::size_t{1} << ShardBits;
+
+        // own cache line each, so locking one shard doesn't slow its neighbours
+        struct alignas(64) Shard {
+            std::mutex lock{};
+            LRUCache<K,V,Hash,Size,Clock> cache{1};
+        };
+
+        Shard shards_[SHARDS]{};
+
+        // @brief           finds shard of a key
+        // @param key       immutable key to hash
+        // @return          shard holding key, if stored
+        Shard& shard(const K& key) {
+            // high bits of the remixed hash, each shard's table uses the low
+            // bits and would see every key of a shard share them
+            std::uint64_t hash = WyMix::mum(std::uint64_t(Hash{}(key)) ^ WyMix::P2, WyMix::P0);
+            return this->shards_[hash >> (64 - ShardBits)];
+        }
+
+        // @brief           sums a counter of every shard
+        // @param get       member function of LRUCache returning the counter
+        // @return          total over shards
+        std::size_t sum(std::size_t (LRUCache<K,V,Hash,Size,Clock>::*get)());
+
+    public:
+        // @brief           creates SHARDS empty caches, allocating every node
+        // @param capacity  max number of entries, >= SHARDS
+        // @param max_bytes max total Size of entries, 0 for no byte budget,
+        //                  else >= SHARDS
+        // @param ttl       time an entry stays valid after its put, zero
+        //                  for no expiry
+        ShardedLRUCache(std::size_t capacity, std::size_t max_bytes = 0, Duration ttl = Duration::zero());
+
+        // locks are shared by all threads, so the cache has one owner
+        ShardedLRUCache(const ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>& other) = delete;
+        ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>& operator=(const ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>& other) = delete;
+
+        // @brief           get number of shards
+        // @return          number of independently locked caches
+        std::size_t shards();
+
+        // Counters are summed one shard after another, so concurrent
+        // updates may or may not be included.
+
+        // @brief           get count
+        // @return          number of entries, expired ones included
+        std::size_t count();
+
+        // @brief           get hits
+        // @return          lookups that found a live entry
+        std::size_t hits();
+
+        // @brief           get misses
+        // @return          lookups that found no entry or an expired one
+        std::size_t misses();
+
+        // @brief           get evictions
+        // @return          entries dropped to make room
+        std::size_t evictions();
+
+        // @brief           get expirations
+        // @return          expired entries dropped by lookups
+        std::size_t expirations();
+
+        // @brief           adds or replaces the entry of a key as most
+        //                  recently used in its shard, see LRUCache::put
+        // @param key       key of entry
+        // @param val       value of entry
+        // @return          false if the entry alone exceeds a shard's budget
+        bool put(K key, V val);
+
+        // @brief           access value stored at specified key, marking it
+        //                  most recently used
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else copy of stored val
+        V at(const K& key, bool& found);
+
+        // @brief           calls fn on the value stored at specified key,
+        //                  marking it most recently used, while holding its
+        //                  shard's lock
+        // @param key       key of value to use
+        // @param fn        callable taking V&, must not use this cache
+        // @return          false if key not found or expired
+        template <typename Fn>
+        bool visit(const K& key, Fn fn);
+
+        // @brief           removes the entry of a key
+        // @param key       key to remove
+        // @return          false if key not found
+        bool remove(const K& key);
+
+        // @brief           removes every entry, one shard at a time
+        void clear();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates SHARDS empty caches, allocating every node
+// @param capacity  max number of entries, >= SHARDS
+// @param max_bytes max total Size of entries, 0 for none, else >= SHARDS
+// @param ttl       time an entry stays valid after its put, zero for none
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::ShardedLRUCache(std::size_t capacity, std::size_t max_bytes, Duration ttl) {
+    if (capacity < SHARDS) {
+        throw std::invalid_argument("Capacity is less than the number of shards");
+    }
+    // a shard budget of 0 would be unlimited
+    if (max_bytes && max_bytes < SHARDS) {
+        throw std::invalid_argument("Byte budget is less than the number of shards");
+    }
+    // the first shards take the remainders, so capacities sum to capacity
+    for (std::size_t i = 0; i < SHARDS; ++i) {
+        std::size_t cap = capacity / SHARDS + (i < capacity % SHARDS);
+        std::size_t bytes = max_bytes / SHARDS + (i < max_bytes % SHARDS);
+        this->shards_[i].cache = LRUCache<K,V,Hash,Size,Clock>(cap, bytes, ttl);
+    }
+}
+
+// @brief           sums a counter of every shard
+// @param get       member function of LRUCache returning the counter
+// @return          total over shards
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::sum(std::size_t (LRUCache<K,V,Hash,Size,Clock>::*get)()) {
+    std::size_t total{0};
+    for (Shard& s : this->shards_) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        total += (s.cache.*get)();
+    }
+    return total;
+}
+
+// Getters.
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::shards() {
+    return SHARDS;
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::count() {
+    return this->sum(&LRUCache<K,V,Hash,Size,Clock>::count);
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::hits() {
+    return this->sum(&LRUCache<K,V,Hash,Size,Clock>::hits);
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::misses() {
+    return this->sum(&LRUCache<K,V,Hash,Size,Clock>::misses);
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::evictions() {
+    return this->sum(&LRUCache<K,V,Hash,Size,Clock>::evictions);
+}
+
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+std::size_t ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::expirations() {
+    return this->sum(&LRUCache<K,V,Hash,Size,Clock>::expirations);
+}
+
+// @brief           adds or replaces the entry of a key
+// @param key       key of entry
+// @param val       value of entry
+// @return          false if the entry alone exceeds a shard's budget
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+bool ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::put(K key, V val) {
+    Shard& s = this->shard(key);
+    std::lock_guard<std::mutex> guard(s.lock);
+    return s.cache.put(std::move(key), std::move(val));
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else copy of stored val
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+V ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::at(const K& key, bool& found) {
+    Shard& s = this->shard(key);
+    std::lock_guard<std::mutex> guard(s.lock);
+    return s.cache.at(key, found);
+}
+
+// @brief           calls fn on the value stored at specified key, while
+//                  holding its shard's lock
+// @param key       key of value to use
+// @param fn        callable taking V&, must not use this cache
+// @return          false if key not found or expired
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+template <typename Fn>
+bool ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::visit(const K& key, Fn fn) {
+    Shard& s = this->shard(key);
+    std::lock_guard<std::mutex> guard(s.lock);
+    V* val = s.cache.find(key);
+    if (val) fn(*val);
+    return val != nullptr;
+}
+
+// @brief           removes the entry of a key
+// @param key       key to remove
+// @return          false if key not found
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+bool ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::remove(const K& key) {
+    Shard& s = this->shard(key);
+    std::lock_guard<std::mutex> guard(s.lock);
+    return s.cache.remove(key);
+}
+
+// @brief           removes every entry, one shard at a time
+template <typename K, typename V, typename Hash, typename Size, typename Clock, std::size_t ShardBits>
+void ShardedLRUCache<K,V,Hash,Size,Clock,ShardBits>::clear() {
+    for (Shard& s : this->shards_) {
+        std::lock_guard<std::mutex> guard(s.lock);
+        s.cache.clear();
+    }
+}
+
+#endif
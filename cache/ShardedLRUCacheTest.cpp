@@ -0,0 +1,79 @@
+// @file         - ShardedLRUCacheTest.cpp
+// @brief        - Testing a sharded LRU cache with many threads
+// @author       - Madhav Malhotra
+// @date         - 2024-01-08
+// @version      - 0.0.0
+// =============================================================================
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "./ShardedLRUCache.hpp"
+
+int main() {
+    // Test initialisation, 1000 entries over 16 shards
+    ShardedLRUCache<int, int> my_cache(1000);
+    std::cout << "Shards: " << my_cache.shards() << std::endl;
+
+    // Test single threaded use
+    for (int i = 0; i < 100; ++i) my_cache.put(i, i);
+    std::cout << "After put: " << my_cache.count() << std::endl;
+
+    bool found = false;
+    std::cout << my_cache.at(42, found) << " " << found << std::endl;
+    my_cache.visit(42, [](int& val) { val *= 2; });
+    std::cout << my_cache.at(42, found) << " " << found << std::endl;
+    std::cout << my_cache.remove(42) << " " << my_cache.remove(42) << std::endl;
+    std::cout << my_cache.at(42, found) << " " << found << std::endl;
+
+    // filling past capacity evicts, never holding more than capacity
+    for (int i = 0; i < 5000; ++i) my_cache.put(i, i);
+    std::cout << "After overfill: " << (my_cache.count() <= 1000);
+    std::cout << ", evictions: " << (my_cache.evictions() >= 4000) << std::endl;
+    std::cout << "Hits: " << my_cache.hits() << ", misses: " << my_cache.misses() << std::endl;
+
+    // many threads putting and getting overlapping keys, values never tear
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 20000;
+    ShardedLRUCache<long long, long long, MixHash<long long>, EntryBytes,
+                    std::chrono::steady_clock, 3> c_cache(4096);
+    std::atomic<bool> consistent{true};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&c_cache, &consistent, t]() {
+            for (long long i = 0; i < PER_THREAD; ++i) {
+                long long key = (i * 31 + t) % 8192;
+                bool hit = false;
+                long long val = c_cache.at(key, hit);
+                if (hit && val != key * 3) consistent = false;
+                if (!hit) c_cache.put(key, key * 3);
+                if (i % 16 == 0) c_cache.remove(key);
+            }
+        });
+    }
+    for (std::thread& t : threads) t.join();
+
+    std::size_t lookups = c_cache.hits() + c_cache.misses();
+    std::cout << "Concurrent size: " << (c_cache.count() <= 4096);
+    std::cout << ", lookups: " << lookups << ", consistent: " << consistent.load() << std::endl;
+
+    c_cache.clear();
+    my_cache.clear();
+    std::cout << "Final size: " << my_cache.count() + c_cache.count() << std::endl;
+
+    try {
+        ShardedLRUCache<int, int> tiny(8);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+    try {
+        ShardedLRUCache<int, int> tiny(64, 8);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
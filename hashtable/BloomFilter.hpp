@@ -0,0 +1,236 @@
+// @file         BloomFilter.hpp
+// @brief        Defining a cache line blocked Bloom filter, standalone or as
+//               the front filter of a hash table's lookups
+// @author       Madhav Malhotra
+// @date         2024-01-07
+// @version      0.0.0
+// =============================================================================
+
+#ifndef HASHTABLE_BLOOM_FILTER_HPP
+#define HASHTABLE_BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include "./HashPolicies.hpp"
+#include "../array/DynamicArray.hpp"
+
+/*
+Declare class
+*/
+
+// Set membership with no false negatives and a configurable rate of false
+// positives. Each key sets and tests all of its bits inside one 64 byte
+// block, so a query reads a single cache line however many hashes it uses.
+// Blocks fill unevenly, so the filter is sized from the expected rate of a
+// blocked filter rather than the textbook formula, using a few more bits.
+// Keys can't be removed, removing a key means building a new filter.
+// Hash - hasher, Hash{}(key). Its output is reseeded, the block comes from
+//        its high bits and the bits within the block from its low bits.
+template <typename K, typename Hash = MixHash<K>>
+class BloomFilter {
+    private:
+        struct alignas(64) Block {
+            std::uint64_t words[8];
+        };
+
+        static constexpr std::size_t BLOCK_BITS = 512;
+        static constexpr std::size_t MAX_HASHES = 16;
+
+        // odd multipliers, one per hash, from split block Bloom filters
+        static constexpr std::uint32_t SALTS[MAX_HASHES] = {
+            0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+            0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+            0xa1b965f5U, 0x8009454fU, 0x724c81edU, 0x51a8749bU,
+            0x747ea2ebU, 0x1f4532e1U, 0xc916ab3dU, 0x41c98ac3U
+        };
+
+        DynamicArray<Block> blocks_;
+        std::size_t hashes_{};
+        std::size_t expected_{};
+        std::size_t count_{};
+        double fpr_{};
+
+        // @brief           hashes input key, reseeded so the filter's bits
+        //                  don't follow the table's bucket bits
+        // @param key       immutable key to hash
+        // @return          mixed hash
+        std::uint64_t hash(const K& key) {
+            return WyMix::mum(std::uint64_t(Hash{}(key)) ^ WyMix::P1, WyMix::P2);
+        }
+
+        // @brief           bit of a hash within its block
+        // @param hash      output of hash()
+        // @param i         index of hash function, < hashes_
+        // @return          bit index, < 512
+        static std::uint32_t bit(std::uint64_t hash, std::size_t i) {
+            // top 9 bits of the low half times salt i. Double hashing would
+            // be cheaper, but repeats bit patterns often enough to miss
+            // rates below 1%. The block index uses the high half.
+            return (std::uint32_t(hash) * SALTS[i]) >> 23;
+        }
+
+        // @brief           expected false positive rate of a blocked filter
+        //                  with a mean number of keys per block
+        // @param per_block mean keys per block, blocks get Poisson counts
+        // @param hashes    bits set per key
+        // @return          expected false positive rate
+        static double blocked_fpr(double per_block, std::size_t hashes);
+
+    public:
+        // @brief           creates filter sized for a number of keys. More
+        //                  keys still work, at a higher false positive rate.
+        // @param expected  number of keys the rate holds for
+        // @param fpr       target false positive rate, 0 < fpr < 1
+        BloomFilter(std::size_t expected = 64, double fpr = 0.01);
+
+        // @brief           adds key to the filter
+        // @param key       key to add
+        void add(const K& key);
+
+        // @brief           tests key, reading one cache line
+        // @param key       key to test
+        // @return          false if key was never added, true if it was
+        //                  or for a false positive
+        bool contains(const K& key);
+
+        // @brief           removes every key, keeping the size
+        void clear();
+
+        // @brief           get count
+        // @return          number of adds, duplicates included
+        std::size_t count();
+
+        // @brief           get expected
+        // @return          number of keys the filter was sized for
+        std::size_t expected();
+
+        // @brief           get false positive rate
+        // @return          target false positive rate
+        double fpr();
+
+        // @brief           get hashes
+        // @return          bits set per key
+        std::size_t hashes();
+
+        // @brief           get memory use
+        // @return          bytes of blocks
+        std::size_t memory();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           expected false positive rate of a blocked filter
+// @param per_block mean keys per block
+// @param hashes    bits set per key
+// @return          expected false positive rate
+template <typename K, typename Hash>
+double BloomFilter<K,Hash>::blocked_fpr(double per_block, std::size_t hashes) {
+    // average a block's rate over its Poisson distributed key count
+    double rate{0};
+    double stop = per_block + 10 * std::sqrt(per_block) + 10;
+    for (double j = 0; j <= stop; ++j) {
+        double p = std::exp(j * std::log(per_block) - per_block - std::lgamma(j + 1));
+        double unset = std::pow(1 - 1.0 / double(BLOCK_BITS), j * double(hashes));
+        rate += p * std::pow(1 - unset, double(hashes));
+    }
+    return rate;
+}
+
+// @brief           creates filter sized for a number of keys
+// @param expected  number of keys the rate holds for
+// @param fpr       target false positive rate, 0 < fpr < 1
+template <typename K, typename Hash>
+BloomFilter<K,Hash>::BloomFilter(std::size_t expected, double fpr) : blocks_(std::size_t(1)), fpr_(fpr) {
+    if (!(fpr > 0 && fpr < 1)) {
+        throw std::invalid_argument("False positive rate is not in range (0, 1)");
+    }
+    this->expected_ = std::max(expected, std::size_t(1));
+
+    // hashes of an unblocked filter at the rate, then grow bits per key from
+    // the unblocked size until the blocked rate meets the target
+    double log2 = std::log(2.0);
+    double hashes = std::round(-std::log(fpr) / log2);
+    this->hashes_ = std::size_t(std::min(std::max(hashes, 1.0), double(MAX_HASHES)));
+    double bits = -std::log(fpr) / (log2 * log2);
+    while (bits < double(BLOCK_BITS) &&
+           blocked_fpr(double(BLOCK_BITS) / bits, this->hashes_) > fpr) {
+        bits *= 1.02;
+    }
+
+    double num = std::ceil(bits * double(this->expected_) / double(BLOCK_BITS));
+    this->blocks_.resize(std::max(std::size_t(num), std::size_t(1)), Block{});
+}
+
+// @brief           adds key to the filter
+// @param key       key to add
+template <typename K, typename Hash>
+void BloomFilter<K,Hash>::add(const K& key) {
+    std::uint64_t hash = this->hash(key);
+    Block& block = this->blocks_[FastRangeReduce::reduce(std::size_t(hash), this->blocks_.length())];
+    for (std::size_t i = 0; i < this->hashes_; ++i) {
+        std::uint32_t bit = BloomFilter<K,Hash>::bit(hash, i);
+        block.words[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+    }
+    ++this->count_;
+}
+
+// @brief           tests key, reading one cache line
+// @param key       key to test
+// @return          false if key was never added
+template <typename K, typename Hash>
+bool BloomFilter<K,Hash>::contains(const K& key) {
+    std::uint64_t hash = this->hash(key);
+    const Block& block = this->blocks_[FastRangeReduce::reduce(std::size_t(hash), this->blocks_.length())];
+
+    // no early exit, which mispredicts on misses. The bits are all in one
+    // cache line, so testing every one costs little past the first.
+    std::uint64_t missing{0};
+    for (std::size_t i = 0; i < this->hashes_; ++i) {
+        std::uint32_t bit = BloomFilter<K,Hash>::bit(hash, i);
+        missing |= ~(block.words[bit >> 6] >> (bit & 63)) & 1;
+    }
+    return missing == 0;
+}
+
+// @brief           removes every key, keeping the size
+template <typename K, typename Hash>
+void BloomFilter<K,Hash>::clear() {
+    for (std::size_t i = 0; i < this->blocks_.length(); ++i) this->blocks_[i] = Block{};
+    this->count_ = 0;
+}
+
+// Getters.
+
+template <typename K, typename Hash>
+std::size_t BloomFilter<K,Hash>::count() {
+    return this->count_;
+}
+
+template <typename K, typename Hash>
+std::size_t BloomFilter<K,Hash>::expected() {
+    return this->expected_;
+}
+
+template <typename K, typename Hash>
+double BloomFilter<K,Hash>::fpr() {
+    return this->fpr_;
+}
+
+template <typename K, typename Hash>
+std::size_t BloomFilter<K,Hash>::hashes() {
+    return this->hashes_;
+}
+
+template <typename K, typename Hash>
+std::size_t BloomFilter<K,Hash>::memory() {
+    return this->blocks_.length() * sizeof(Block);
+}
+
+#endif
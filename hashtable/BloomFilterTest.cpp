@@ -0,0 +1,80 @@
+// @file         - BloomFilterTest.cpp
+// @brief        - Testing blocked Bloom filters, standalone and in front of
+//                 hash table lookups
+// @author       - Madhav Malhotra
+// @date         - 2024-01-07
+// @version      - 0.0.0
+// =============================================================================
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include "./BloomFilter.hpp"
+#include "./LinearProbing.hpp"
+
+int main() {
+    // Test no false negatives, and a false positive rate near the target
+    BloomFilter<int> filter(10000, 0.01);
+    for (int i = 0; i < 10000; ++i) filter.add(i * 2);
+    std::size_t negatives = 0, positives = 0;
+    for (int i = 0; i < 10000; ++i) negatives += !filter.contains(i * 2);
+    for (int i = 0; i < 100000; ++i) positives += filter.contains(i * 2 + 1);
+    std::cout << "Added: " << filter.count() << ", hashes: " << filter.hashes();
+    std::cout << ", false negatives: " << negatives;
+    std::cout << ", false positives under 1.5%: " << (positives < 1500) << std::endl;
+
+    // Test lower rates use more bits
+    BloomFilter<int> strict(10000, 0.001);
+    std::cout << "Bytes at 1%: " << filter.memory() << ", at 0.1%: " << strict.memory() << std::endl;
+
+    // Test string keys and clearing
+    BloomFilter<std::string> words(100, 0.05);
+    for (int i = 0; i < 100; ++i) words.add("word" + std::to_string(i));
+    std::cout << "Word found: " << words.contains("word42");
+    words.clear();
+    std::cout << ", after clear: " << words.contains("word42") << std::endl;
+
+    try {
+        BloomFilter<int> wrong(100, 1.0);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    // Test front filter of LP_HashTable through growth, removals and rebuilds
+    LP_HashTable<int, int> my_map{};
+    my_map.set_filter_fpr(0.01);
+    for (int i = 0; i < 5000; ++i) my_map.add(i, i * 7);
+    for (int i = 0; i < 5000; i += 3) my_map.remove(i);
+    std::size_t correct = 0;
+    for (int i = -1000; i < 6000; ++i) {
+        bool found = false;
+        int val = my_map.at(i, found);
+        bool stored = i >= 0 && i < 5000 && i % 3 != 0;
+        correct += (stored) ? found && val == i * 7 : !found;
+    }
+    std::cout << "Filtered LP: " << my_map.count() << ", correct: " << correct << " of 7000" << std::endl;
+
+    // and mid incremental resize, through batched lookups
+    LP_HashTable<int, int, std::allocator<KeyValue<int, int>>, MixHash<int>, LinearProbe, MaskReduce> step_map{};
+    step_map.set_resize_step(2);
+    step_map.set_filter_fpr(0.05);
+    int keys[64]{};
+    int vals[64]{};
+    bool found[64]{};
+    for (int i = 0; i < 100; ++i) step_map.add(i, i);
+    for (int i = 0; i < 64; ++i) keys[i] = i * 3;
+    step_map.at_batch(keys, 64, vals, found);
+    std::size_t hits = 0;
+    for (int i = 0; i < 64; ++i) hits += found[i] && vals[i] == i * 3;
+    std::cout << "Filtered batch, resizing: " << step_map.resizing() << ", hits: " << hits << std::endl;
+
+    // copies keep the filter, clearing and dropping it leave the table working
+    LP_HashTable<int, int> copy_map(my_map);
+    my_map.clear();
+    my_map.add(3, 3);
+    copy_map.set_filter_fpr(0);
+    std::cout << "Copy finds: " << (copy_map.find(4) != nullptr) << ", cleared finds: ";
+    std::cout << (my_map.find(4) != nullptr) << " " << (my_map.find(3) != nullptr) << std::endl;
+
+    return 0;
+}
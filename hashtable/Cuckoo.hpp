@@ -0,0 +1,521 @@
+// @file         Cuckoo.hpp
+// @brief        Defining a bucketized cuckoo hashtable, every key lives in
+//               one of two 4 slot buckets
+// @author       Madhav Malhotra
+// @date         2024-01-03
+// @version      0.0.0
+// =============================================================================
+
+#ifndef HASHTABLE_CUCKOO_HPP
+#define HASHTABLE_CUCKOO_HPP
+
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "./HashPolicies.hpp"
+#include "./KeyValue.hpp"
+#include "../array/DynamicArray.hpp"
+
+/*
+Declare class
+*/
+
+// Cuckoo hashing: a key is only ever stored in one of its two candidate
+// buckets, so a lookup reads at most two buckets (and the stash, while it
+// holds anything). Inserts into two full buckets search breadth first for
+// the shortest chain of entries that can each move to their other bucket.
+// If none is found, the entry waits in a small stash, and once that is full
+// the table rehashes with a new seed, or doubles when it's over half full.
+// Hash - hasher, Hash{}(key). Its output is reseeded and split into the two
+//        bucket indices, which use different bits of the result.
+template <typename K, typename V, typename Alloc = std::allocator<KeyValue<K,V>>,
+          typename Hash = MixHash<K>>
+class CK_HashTable {
+    protected:
+        using Buckets = DynamicArray< KeyValue<K,V>, Alloc >;
+
+        static constexpr std::size_t SLOTS = 4;         // slots per bucket
+        static constexpr std::size_t STASH = 4;         // slots after buckets
+        static constexpr std::size_t INIT_BUCKETS = 4;  // power of 2
+        static constexpr std::size_t MAX_SEARCH = 256;  // slots per insert search
+
+        // buckets_ * SLOTS bucket slots, followed by STASH stash slots.
+        // Empty slots are notinit, removal never leaves tombstones.
+        Buckets arr_;
+        std::size_t buckets_{INIT_BUCKETS};
+        float load_threshold_{0.9};
+        std::size_t count_{};
+        std::size_t stashed_{};
+        std::uint64_t seed_{WyMix::P0};
+
+        // @brief           hashes input key with the current seed
+        // @param key       immutable key to hash
+        // @return          mixed hash, low half picks the first bucket and
+        //                  high half the second
+        std::uint64_t hash(const K& key);
+
+        // @brief           finds both candidate buckets of a hash
+        // @param hash      output of hash()
+        // @param first     output parameter, first bucket
+        // @param second    output parameter, second bucket, never first
+        void candidates(std::uint64_t hash, std::size_t& first, std::size_t& second);
+
+        // @brief           finds the other candidate bucket of a stored key
+        // @param key       key stored in bucket
+        // @param bucket    one of key's candidate buckets
+        // @return          the other candidate bucket
+        std::size_t alternate(const K& key, std::size_t bucket);
+
+        // @brief           finds slot holding key
+        // @param key       key to search for
+        // @return          slot index, length of arr_ if not found
+        std::size_t locate(const K& key);
+
+        // @brief           moves kv into a free slot of its buckets, displacing
+        //                  entries along the shortest path found, or else into
+        //                  the stash. Skips duplicate checks and resizing.
+        // @param kv        entry to place, only moved from on success
+        // @return          false if the table is unchanged because no path
+        //                  was found and the stash is full
+        bool place(KeyValue<K,V>& kv);
+
+        // @brief           places an entry known not to be stored, rehashing
+        //                  until it fits
+        // @param kv        entry to place
+        void insert(KeyValue<K,V>& kv);
+
+        // @brief           moves every entry into num new buckets with a new seed
+        // @param num       number of buckets, power of 2
+        void rehash(std::size_t num);
+
+    public:
+        // @brief           creates empty hash table with 4 buckets of 4 slots
+        // @param alloc     allocator for slot array
+        CK_HashTable(const Alloc& alloc = Alloc{});
+
+        // copy and move. Moved from tables are left empty with 4 buckets
+        CK_HashTable(const CK_HashTable<K,V,Alloc,Hash>& other) = default;
+        CK_HashTable<K,V,Alloc,Hash>& operator=(const CK_HashTable<K,V,Alloc,Hash>& other) = default;
+        CK_HashTable(CK_HashTable<K,V,Alloc,Hash>&& other);
+        CK_HashTable<K,V,Alloc,Hash>& operator=(CK_HashTable<K,V,Alloc,Hash>&& other);
+
+        // destructor
+        ~CK_HashTable() = default;
+
+        // @brief           get count
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           get number of entries waiting in the stash
+        // @return          0 unless inserts found no displacement path
+        std::size_t stashed();
+
+        // @brief           get load threshold (max kv pairs / bucket slots)
+        // @return          load threshold setting
+        float load_threshold();
+
+        // @brief           get load factor (current kv pairs / bucket slots)
+        // @return          current load factor
+        float load_factor();
+
+        // @brief                set load factor
+        // @param load_threshold    0 < factor <= 1. Recommended range: 0.8-0.95
+        void set_load_threshold(float load_threshold);
+
+        // @brief           add a key value pair to the hash table
+        // @param key       immutable key for new key value pair
+        // @param val       arbitrary data type value for key val pair
+        // @return          false if failed for reasons like duplicate keys
+        bool add(K key, V val);
+
+        // @brief           add a key with a value constructed from args
+        // @param key       immutable key for new key value pair
+        // @param args      arguments forwarded to V's constructor, only
+        //                  used if the key isn't already stored
+        // @return          false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
+        // @brief           remove a key value pair from the hash table
+        // @param key       immutable key to find kv pair to remove
+        // @return          false if failed for reasons like key not found
+        bool remove(const K& key);
+
+        // @brief           access value stored at specified key
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found.
+        //                  Invalidated by later additions or removals.
+        V* find(const K& key);
+
+        // @brief           moves els to 2x as many buckets
+        void double_capacity();
+
+        // @brief           deletes all elements
+        void clear();
+
+        // @brief           pretty prints saved data to console, one bucket
+        //                  per line and the stash last
+        void print();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates empty hash table with 4 buckets of 4 slots
+// @param alloc     allocator for slot array
+template <typename K, typename V, typename Alloc, typename Hash>
+CK_HashTable<K,V,Alloc,Hash>::CK_HashTable(const Alloc& alloc)
+    : arr_(INIT_BUCKETS * SLOTS + STASH, KeyValue<K,V>{}, alloc) {}
+
+// @brief           takes other table's slots, leaving it empty
+template <typename K, typename V, typename Alloc, typename Hash>
+CK_HashTable<K,V,Alloc,Hash>::CK_HashTable(CK_HashTable<K,V,Alloc,Hash>&& other)
+    : arr_(std::move(other.arr_)), buckets_(other.buckets_),
+      load_threshold_(other.load_threshold_), count_(other.count_),
+      stashed_(other.stashed_), seed_(other.seed_) {
+    other.clear();
+}
+
+// @brief           takes other table's slots, leaving it empty
+template <typename K, typename V, typename Alloc, typename Hash>
+CK_HashTable<K,V,Alloc,Hash>& CK_HashTable<K,V,Alloc,Hash>::operator=(CK_HashTable<K,V,Alloc,Hash>&& other) {
+    if (this != &other) {
+        this->arr_ = std::move(other.arr_);
+        this->buckets_ = other.buckets_;
+        this->load_threshold_ = other.load_threshold_;
+        this->count_ = other.count_;
+        this->stashed_ = other.stashed_;
+        this->seed_ = other.seed_;
+        other.clear();
+    }
+    return *this;
+}
+
+// Getters and setters.
+template <typename K, typename V, typename Alloc, typename Hash>
+std::size_t CK_HashTable<K,V,Alloc,Hash>::count() {
+    return this->count_;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash>
+std::size_t CK_HashTable<K,V,Alloc,Hash>::stashed() {
+    return this->stashed_;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash>
+float CK_HashTable<K,V,Alloc,Hash>::load_threshold() {
+    return this->load_threshold_;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash>
+float CK_HashTable<K,V,Alloc,Hash>::load_factor() {
+    return float(this->count_) / float(this->buckets_ * SLOTS);
+}
+
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::set_load_threshold(float load_threshold) {
+    if (load_threshold > 0 && load_threshold <= 1) {
+        this->load_threshold_ = load_threshold;
+    } else {
+        throw std::invalid_argument("Load factor is not in range (0, 1]");
+    }
+}
+
+// @brief           hashes input key with the current seed
+// @param key       immutable key to hash
+// @return          mixed hash, low half picks the first bucket and
+//                  high half the second
+template <typename K, typename V, typename Alloc, typename Hash>
+std::uint64_t CK_HashTable<K,V,Alloc,Hash>::hash(const K& key) {
+    return WyMix::mum(std::uint64_t(Hash{}(key)) ^ this->seed_, WyMix::P2);
+}
+
+// @brief           finds both candidate buckets of a hash
+// @param hash      output of hash()
+// @param first     output parameter, first bucket
+// @param second    output parameter, second bucket, never first
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::candidates(std::uint64_t hash, std::size_t& first, std::size_t& second) {
+    std::size_t mask = this->buckets_ - 1;
+    first = std::size_t(hash) & mask;
+    second = std::size_t(hash >> 32) & mask;
+    // a key with one candidate bucket could never be displaced
+    if (second == first) second = first ^ 1;
+}
+
+// @brief           finds the other candidate bucket of a stored key
+// @param key       key stored in bucket
+// @param bucket    one of key's candidate buckets
+// @return          the other candidate bucket
+template <typename K, typename V, typename Alloc, typename Hash>
+std::size_t CK_HashTable<K,V,Alloc,Hash>::alternate(const K& key, std::size_t bucket) {
+    std::size_t first{}, second{};
+    this->candidates(this->hash(key), first, second);
+    return (bucket == first) ? second : first;
+}
+
+// @brief           finds slot holding key
+// @param key       key to search for
+// @return          slot index, length of arr_ if not found
+template <typename K, typename V, typename Alloc, typename Hash>
+std::size_t CK_HashTable<K,V,Alloc,Hash>::locate(const K& key) {
+    std::size_t first{}, second{};
+    this->candidates(this->hash(key), first, second);
+
+    // both buckets are independent reads, so start loading the second
+    KeyValue<K,V>* slots = this->arr_.data();
+    prefetch(slots + second * SLOTS);
+
+    for (std::size_t i = first * SLOTS; i < (first + 1) * SLOTS; ++i) {
+        if (!slots[i].notinit && slots[i].key == key) return i;
+    }
+    for (std::size_t i = second * SLOTS; i < (second + 1) * SLOTS; ++i) {
+        if (!slots[i].notinit && slots[i].key == key) return i;
+    }
+
+    if (this->stashed_) {
+        std::size_t end = this->buckets_ * SLOTS + STASH;
+        for (std::size_t i = this->buckets_ * SLOTS; i < end; ++i) {
+            if (!slots[i].notinit && slots[i].key == key) return i;
+        }
+    }
+    return this->arr_.length();
+}
+
+// @brief           moves kv into a free slot of its buckets, displacing
+//                  entries along the shortest path found, or else into
+//                  the stash. Skips duplicate checks and resizing.
+// @param kv        entry to place, only moved from on success
+// @return          false if the table is unchanged because no path
+//                  was found and the stash is full
+template <typename K, typename V, typename Alloc, typename Hash>
+bool CK_HashTable<K,V,Alloc,Hash>::place(KeyValue<K,V>& kv) {
+    KeyValue<K,V>* slots = this->arr_.data();
+    std::size_t first{}, second{};
+    this->candidates(this->hash(kv.key), first, second);
+
+    // one slot of a candidate path, whose entry would move to its other
+    // bucket. parent is the step whose entry would move into this slot.
+    struct Step {
+        std::size_t bucket;
+        std::size_t slot;
+        std::ptrdiff_t parent;
+    };
+    Step steps[MAX_SEARCH];
+    std::size_t tail{0};
+
+    // free slot in either bucket
+    for (std::size_t bucket : {first, second}) {
+        for (std::size_t s = 0; s < SLOTS; ++s) {
+            if (slots[bucket * SLOTS + s].notinit) {
+                slots[bucket * SLOTS + s] = std::move(kv);
+                return true;
+            }
+            steps[tail++] = Step{bucket, s, -1};
+        }
+    }
+
+    // breadth first, so the path found moves as few entries as possible
+    for (std::size_t head = 0; head < tail; ++head) {
+        Step& step = steps[head];
+        std::size_t alt = this->alternate(slots[step.bucket * SLOTS + step.slot].key, step.bucket);
+
+        // a bucket already on the path would have its slots moved twice
+        bool cycle = false;
+        for (std::ptrdiff_t p = std::ptrdiff_t(head); p != -1; p = steps[p].parent) {
+            cycle = cycle || steps[p].bucket == alt;
+        }
+        if (cycle) continue;
+
+        for (std::size_t s = 0; s < SLOTS; ++s) {
+            if (!slots[alt * SLOTS + s].notinit) continue;
+
+            // shift entries along the path, from its free end back to the root
+            std::size_t to = alt * SLOTS + s;
+            for (std::ptrdiff_t p = std::ptrdiff_t(head); p != -1; p = steps[p].parent) {
+                std::size_t from = steps[p].bucket * SLOTS + steps[p].slot;
+                slots[to] = std::move(slots[from]);
+                to = from;
+            }
+            slots[to] = std::move(kv);
+            return true;
+        }
+
+        for (std::size_t s = 0; s < SLOTS && tail < MAX_SEARCH; ++s) {
+            steps[tail++] = Step{alt, s, std::ptrdiff_t(head)};
+        }
+    }
+
+    // no path, wait in the stash
+    std::size_t end = this->buckets_ * SLOTS + STASH;
+    for (std::size_t i = this->buckets_ * SLOTS; i < end; ++i) {
+        if (slots[i].notinit) {
+            slots[i] = std::move(kv);
+            ++this->stashed_;
+            return true;
+        }
+    }
+    return false;
+}
+
+// @brief           places an entry known not to be stored, rehashing
+//                  until it fits
+// @param kv        entry to place
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::insert(KeyValue<K,V>& kv) {
+    // a new seed is usually enough to break up unlucky collisions. Tables
+    // over half full, or still stuck after reseeding, grow instead.
+    bool reseeded = false;
+    while (!this->place(kv)) {
+        bool grow = reseeded || this->load_factor() > 0.5f;
+        this->rehash((grow) ? this->buckets_ * 2 : this->buckets_);
+        reseeded = true;
+    }
+}
+
+// @brief           add a key value pair to the hash table
+// @param key       immutable key for new key value pair
+// @param val       arbitrary data type value for key val pair
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc, typename Hash>
+bool CK_HashTable<K,V,Alloc,Hash>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           add a key with a value constructed from args
+// @param key       immutable key for new key value pair
+// @param args      arguments forwarded to V's constructor, only
+//                  used if the key isn't already stored
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc, typename Hash>
+template <typename... Args>
+bool CK_HashTable<K,V,Alloc,Hash>::emplace(K key, Args&&... args) {
+    if (this->locate(key) < this->arr_.length()) return false;
+
+    // grow first, displacement paths get long close to full
+    if (float(this->count_ + 1) > this->load_threshold_ * float(this->buckets_ * SLOTS)) {
+        this->double_capacity();
+    }
+
+    KeyValue<K,V> kv{std::move(key), V(std::forward<Args>(args)...), false, false};
+    this->insert(kv);
+    ++this->count_;
+    return true;
+}
+
+// @brief           remove a key value pair from the hash table
+// @param key       immutable key to find kv pair to remove
+// @return          false if failed for reasons like key not found
+template <typename K, typename V, typename Alloc, typename Hash>
+bool CK_HashTable<K,V,Alloc,Hash>::remove(const K& key) {
+    std::size_t idx = this->locate(key);
+    if (idx == this->arr_.length()) return false;
+
+    KeyValue<K,V>* slots = this->arr_.data();
+    slots[idx] = KeyValue<K,V>{};
+    --this->count_;
+
+    std::size_t stash_start = this->buckets_ * SLOTS;
+    if (idx >= stash_start) {
+        --this->stashed_;
+        return true;
+    }
+
+    // a stashed entry that belongs in the freed bucket moves back, so
+    // lookups skip the stash again sooner
+    std::size_t bucket = idx / SLOTS;
+    for (std::size_t i = stash_start; this->stashed_ && i < stash_start + STASH; ++i) {
+        if (slots[i].notinit) continue;
+
+        std::size_t first{}, second{};
+        this->candidates(this->hash(slots[i].key), first, second);
+        if (first == bucket || second == bucket) {
+            slots[idx] = std::move(slots[i]);
+            slots[i] = KeyValue<K,V>{};
+            --this->stashed_;
+            break;
+        }
+    }
+    return true;
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Alloc, typename Hash>
+V CK_HashTable<K,V,Alloc,Hash>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           find value stored at specified key, without
+//                  copying it
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found.
+//                  Invalidated by later additions or removals.
+template <typename K, typename V, typename Alloc, typename Hash>
+V* CK_HashTable<K,V,Alloc,Hash>::find(const K& key) {
+    std::size_t idx = this->locate(key);
+    return (idx < this->arr_.length()) ? &this->arr_.at(idx).val : nullptr;
+}
+
+// @brief           moves els to 2x as many buckets
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::double_capacity() {
+    this->rehash(this->buckets_ * 2);
+}
+
+// @brief           moves every entry into num new buckets with a new seed
+// @param num       number of buckets, power of 2
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::rehash(std::size_t num) {
+    // take old slots, then create new array
+    Buckets old(std::move(this->arr_));
+    this->arr_ = Buckets(num * SLOTS + STASH, KeyValue<K,V>{}, old.get_allocator());
+    this->buckets_ = num;
+    this->stashed_ = 0;
+    this->seed_ = WyMix::mum(this->seed_ ^ WyMix::P1, WyMix::P0);
+
+    // stash included, placing may rehash again if this seed is unlucky
+    for (KeyValue<K,V>& kv : old) {
+        if (!kv.notinit) this->insert(kv);
+    }
+}
+
+// @brief           removes all stored data in the hashtable
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::clear() {
+    // restore the initial empty buckets so the table stays usable
+    this->arr_ = Buckets(INIT_BUCKETS * SLOTS + STASH, KeyValue<K,V>{}, this->arr_.get_allocator());
+    this->buckets_ = INIT_BUCKETS;
+    this->count_ = 0;
+    this->stashed_ = 0;
+}
+
+// @brief           pretty print hashtable elements
+template <typename K, typename V, typename Alloc, typename Hash>
+void CK_HashTable<K,V,Alloc,Hash>::print() {
+    std::size_t len = this->arr_.length();
+    for (std::size_t i = 0; i < len; ++i) {
+        std::cout << this->arr_.at(i);
+        if ((i + 1) % SLOTS == 0 || i + 1 == len) std::cout << std::endl;
+    }
+}
+
+
+#endif
@@ -0,0 +1,80 @@
+// @file         - CuckooTest.cpp
+// @brief        - Testing a bucketized cuckoo hashtable
+// @author       - Madhav Malhotra
+// @date         - 2024-01-03
+// @version      - 0.0.0
+// =============================================================================
+
+#include <random>
+#include <iostream>
+#include "./Cuckoo.hpp"
+
+int main() {
+    // Test initialisation
+    CK_HashTable<int, short> my_map{};
+    std::cout << "Init" << std::endl;
+
+    std::cout << "Old load threshold: " << my_map.load_threshold() << std::endl;
+    my_map.set_load_threshold(0.95);
+    std::cout << "New load threshold: " << my_map.load_threshold() << std::endl;
+
+    // Test data addition
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(1,10000000);
+    std::size_t idx = 0;
+    std::size_t indices[28]{};
+
+    for (std::size_t i = 0; i < 28; ++i) {
+        idx = dist(gen);
+        indices[i] = idx;
+        my_map.add(idx, i);
+    }
+    std::cout << "Duplicate added: " << my_map.add(idx, 0) << std::endl;
+    std::cout << "Count after addition: " << my_map.count() << std::endl;
+
+    // Test retrieval
+    bool found = false;
+    std::cout << my_map.at(idx, found) << " " << found << std::endl;
+    std::cout << my_map.at(idx-2, found) << " " << found << std::endl;
+
+    // Test removal, remaining keys must still be found
+    std::cout << "Removing indices: ";
+    for (std::size_t i = 10; i < 19; ++i) {
+        bool removed = my_map.remove(indices[i]);
+        if (removed) std::cout << indices[i] << ", ";
+    }
+    std::cout << std::endl;
+
+    std::size_t still_found = 0;
+    for (std::size_t i = 0; i < 28; ++i) {
+        still_found += my_map.find(indices[i]) != nullptr;
+    }
+    std::cout << "Still found: " << still_found << std::endl;
+
+    std::cout << my_map.remove(dist(gen)) << std::endl;
+    std::cout << "Size: " << my_map.count() << std::endl;
+
+    // Test high load, displacement and the stash must keep every key
+    CK_HashTable<int, int> full_map{};
+    full_map.set_load_threshold(0.97);
+    std::size_t full_found = 0;
+    for (int i = 0; i < 100000; ++i) full_map.add(i * 7, i);
+    for (int i = 0; i < 100000; ++i) {
+        int* val = full_map.find(i * 7);
+        full_found += val && *val == i;
+    }
+    std::cout << "Found at high load: " << full_found << ", load over 0.45: ";
+    std::cout << (full_map.load_factor() > 0.45f) << std::endl;
+
+    // Test moving and reuse after clearing
+    CK_HashTable<int, short> map_moved(std::move(my_map));
+    std::cout << "Moved size: " << map_moved.count();
+    std::cout << ", source size: " << my_map.count() << std::endl;
+
+    map_moved.clear();
+    map_moved.emplace(5, 7);
+    map_moved.print();
+    std::cout << "Final size: " << map_moved.count() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+// @file         FrozenTable.hpp
+// @brief        Defining a read only hashtable built over a minimal perfect
+//               hash of a fixed set of keys
+// @author       Madhav Malhotra
+// @date         2024-01-06
+// @version      0.0.0
+// =============================================================================
+
+#ifndef HASHTABLE_FROZEN_TABLE_HPP
+#define HASHTABLE_FROZEN_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "./HashPolicies.hpp"
+#include "../array/DynamicArray.hpp"
+
+/*
+Declare class
+*/
+
+// PTHash style perfect hashing. Keys are split into small buckets, and each
+// bucket gets a pilot, the first value that sends all its keys to distinct
+// free positions when mixed into their hashes. Buckets are placed largest
+// first, while free positions are plentiful. A lookup hashes the key, reads
+// its bucket's 2 byte pilot and probes exactly one entry, so there are no
+// probe sequences, tombstones or empty entries.
+// Positions are drawn from slightly more than count() slots so the last
+// buckets find pilots quickly. The few keys landing past count() are sent
+// to free slots below it by a small remap array.
+// Hash - hasher, Hash{}(key). Its output is reseeded, and split into the
+//        bucket (high bits) and the input to position mixing (all bits).
+template <typename K, typename V, typename Hash = MixHash<K>>
+class FrozenTable {
+    private:
+        struct Entry {
+            K key{};
+            V val{};
+        };
+
+        static constexpr std::size_t BUCKET_KEYS = 3;       // mean keys per bucket
+        static constexpr std::size_t MAX_PILOT = 0xffff;    // pilots are 2 bytes
+        static constexpr std::size_t MAX_SEEDS = 64;        // builds before giving up
+
+        DynamicArray<Entry> entries_;
+        DynamicArray<std::uint16_t> pilots_;
+        DynamicArray<std::size_t> remap_;       // slot of positions >= count_
+        std::size_t count_{};
+        std::size_t positions_{};               // count_ plus ~2%
+        std::size_t buckets_{};
+        std::size_t dense_{};                   // buckets taking 60% of keys
+        std::uint64_t seed_{WyMix::P0};
+
+        // @brief           hashes input key with the current seed
+        // @param key       immutable key to hash
+        // @return          mixed hash
+        std::uint64_t hash(const K& key) {
+            return WyMix::mum(std::uint64_t(Hash{}(key)) ^ this->seed_, WyMix::P2);
+        }
+
+        // @brief           bucket of a hash. 60% of keys go to the first
+        //                  30% of buckets, so those dense buckets are
+        //                  placed while the table is still nearly empty.
+        // @param hash      output of hash()
+        // @return          bucket index
+        std::size_t bucket(std::uint64_t hash);
+
+        // @brief           position of a hash for a pilot
+        // @param hash      output of hash()
+        // @param pilot     pilot of hash's bucket
+        // @return          position, < positions_
+        std::size_t position(std::uint64_t hash, std::size_t pilot);
+
+        // @brief           finds a pilot for every bucket with the current
+        //                  seed, then places entries by it
+        // @param src       entries to place, count_ of them
+        // @return          false if some bucket has no pilot, or two keys
+        //                  share a hash, so a new seed is needed
+        bool build(DynamicArray<Entry>& src);
+
+        // @brief           finds entry of key
+        // @param key       key to search for
+        // @return          entry index, key must still be compared
+        std::size_t locate(const K& key);
+
+    public:
+        // @brief           creates empty table
+        FrozenTable();
+
+        // @brief           builds a table holding copies of every entry of
+        //                  a hash table, e.g. LP_HashTable or SC_HashTable
+        // @param table     table to copy, iterable over KeyValue entries
+        //                  with unique keys. Not a FrozenTable, which
+        //                  the copy constructor copies.
+        template <typename Table, typename = typename std::enable_if<
+                      !std::is_same<typename std::decay<Table>::type, FrozenTable<K,V,Hash>>::value>::type>
+        explicit FrozenTable(Table& table);
+
+        // @brief           get count
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           get memory use
+        // @return          bytes of entries, pilots and remap array
+        std::size_t memory();
+
+        // @brief           access value stored at specified key
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found
+        const V* find(const K& key);
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates empty table
+template <typename K, typename V, typename Hash>
+FrozenTable<K,V,Hash>::FrozenTable() : entries_(std::size_t(1)), pilots_(std::size_t(1)),
+                                       remap_(std::size_t(1)) {}
+
+// @brief           builds a table holding copies of every entry of a table
+// @param table     table to copy, iterable over KeyValue entries
+template <typename K, typename V, typename Hash>
+template <typename Table, typename>
+FrozenTable<K,V,Hash>::FrozenTable(Table& table) : FrozenTable() {
+    std::size_t num = table.count();
+    if (num == 0) return;
+
+    DynamicArray<Entry> src(num);
+    for (auto& kv : table) src.push(Entry{kv.key, kv.val});
+
+    this->count_ = num;
+    this->positions_ = num + num / 50 + 1;
+    this->buckets_ = (num + BUCKET_KEYS - 1) / BUCKET_KEYS + 1;
+    this->dense_ = this->buckets_ * 3 / 10;
+    if (this->dense_ == 0) this->dense_ = 1;
+
+    for (std::size_t attempt = 0; attempt < MAX_SEEDS; ++attempt) {
+        if (this->build(src)) return;
+        this->seed_ = WyMix::mum(this->seed_ ^ WyMix::P1, WyMix::P2 + attempt);
+    }
+    throw std::runtime_error("FrozenTable found no perfect hash, keys may repeat");
+}
+
+// @brief           bucket of a hash
+// @param hash      output of hash()
+// @return          bucket index
+template <typename K, typename V, typename Hash>
+std::size_t FrozenTable<K,V,Hash>::bucket(std::uint64_t hash) {
+    // 0.6 * 2^32, low bits pick the group and high bits the bucket within it
+    constexpr std::uint64_t DENSE_KEYS = 2576980377ULL;
+    std::uint64_t high = hash >> 32;
+    if ((hash & 0xffffffffULL) < DENSE_KEYS) {
+        return std::size_t((high * this->dense_) >> 32);
+    }
+    return this->dense_ + std::size_t((high * (this->buckets_ - this->dense_)) >> 32);
+}
+
+// @brief           position of a hash for a pilot
+// @param hash      output of hash()
+// @param pilot     pilot of hash's bucket
+// @return          position, < positions_
+template <typename K, typename V, typename Hash>
+std::size_t FrozenTable<K,V,Hash>::position(std::uint64_t hash, std::size_t pilot) {
+    // keys of a bucket share high bits, the multiply spreads their low bits
+    std::uint64_t mixed = (hash ^ WyMix::mum(pilot ^ WyMix::P0, WyMix::P1)) * 0x9e3779b97f4a7c15ULL;
+    return FastRangeReduce::reduce(std::size_t(mixed), this->positions_);
+}
+
+// @brief           finds a pilot for every bucket, then places entries
+// @param src       entries to place, count_ of them
+// @return          false if a new seed is needed
+template <typename K, typename V, typename Hash>
+bool FrozenTable<K,V,Hash>::build(DynamicArray<Entry>& src) {
+    std::size_t num = this->count_;
+    std::size_t buckets = this->buckets_;
+
+    // group entries by bucket with a counting sort, starts[b] is the first
+    // of bucket b's entries in order
+    DynamicArray<std::uint64_t> hashes(num);
+    DynamicArray<std::size_t> starts(buckets + 1, 0);
+    for (std::size_t i = 0; i < num; ++i) {
+        hashes.push(this->hash(src[i].key));
+        ++starts[this->bucket(hashes[i]) + 1];
+    }
+    for (std::size_t b = 0; b < buckets; ++b) starts[b + 1] += starts[b];
+
+    DynamicArray<std::size_t> order(num, 0);
+    DynamicArray<std::size_t> fill(buckets, 0);
+    for (std::size_t i = 0; i < num; ++i) {
+        std::size_t b = this->bucket(hashes[i]);
+        order[starts[b] + fill[b]++] = i;
+    }
+
+    // hashes in bucket order, so pilot searches read them contiguously.
+    // hashes then stores the position each is placed at.
+    DynamicArray<std::uint64_t> grouped(num);
+    for (std::size_t i = 0; i < num; ++i) grouped.push(hashes[order[i]]);
+
+    // buckets by size, largest first, again by counting sort
+    std::size_t max_size{0};
+    for (std::size_t b = 0; b < buckets; ++b) {
+        std::size_t size = starts[b + 1] - starts[b];
+        if (size > max_size) max_size = size;
+    }
+    DynamicArray<std::size_t> by_size(max_size + 2, 0);
+    for (std::size_t b = 0; b < buckets; ++b) ++by_size[max_size - (starts[b + 1] - starts[b]) + 1];
+    for (std::size_t s = 0; s <= max_size; ++s) by_size[s + 1] += by_size[s];
+    DynamicArray<std::size_t> sorted(buckets, 0);
+    for (std::size_t b = 0; b < buckets; ++b) {
+        sorted[by_size[max_size - (starts[b + 1] - starts[b])]++] = b;
+    }
+
+    // one bit per position
+    DynamicArray<std::uint64_t> taken((this->positions_ + 63) / 64, 0);
+    this->pilots_ = DynamicArray<std::uint16_t>(buckets, 0);
+    DynamicArray<std::size_t> placed(max_size + 1, 0);
+
+    for (std::size_t s = 0; s < buckets; ++s) {
+        std::size_t b = sorted[s];
+        std::size_t first = starts[b], last = starts[b + 1];
+        if (first == last) break;
+
+        // equal hashes can never be separated
+        for (std::size_t i = first; i < last; ++i) {
+            for (std::size_t j = i + 1; j < last; ++j) {
+                if (grouped[i] == grouped[j]) return false;
+            }
+        }
+
+        std::size_t pilot = 0;
+        for (; pilot <= MAX_PILOT; ++pilot) {
+            // take positions one by one, releasing them if any collides
+            std::size_t num_placed = 0;
+            for (std::size_t i = first; i < last; ++i) {
+                std::size_t pos = this->position(grouped[i], pilot);
+                std::uint64_t bit = std::uint64_t{1} << (pos % 64);
+                if (taken[pos / 64] & bit) break;
+                taken[pos / 64] |= bit;
+                placed[num_placed++] = pos;
+            }
+            if (num_placed == last - first) break;
+            for (std::size_t i = 0; i < num_placed; ++i) {
+                taken[placed[i] / 64] &= ~(std::uint64_t{1} << (placed[i] % 64));
+            }
+        }
+        if (pilot > MAX_PILOT) return false;
+        this->pilots_[b] = std::uint16_t(pilot);
+        for (std::size_t i = first; i < last; ++i) hashes[i] = placed[i - first];
+    }
+
+    // positions past num fill the free slots below it, in order
+    this->remap_ = DynamicArray<std::size_t>(this->positions_ - num, 0);
+    std::size_t free_slot = 0;
+    for (std::size_t pos = num; pos < this->positions_; ++pos) {
+        if (!(taken[pos / 64] & (std::uint64_t{1} << (pos % 64)))) continue;
+        while (taken[free_slot / 64] & (std::uint64_t{1} << (free_slot % 64))) ++free_slot;
+        this->remap_[pos - num] = free_slot++;
+    }
+
+    this->entries_ = DynamicArray<Entry>(num, Entry{});
+    for (std::size_t i = 0; i < num; ++i) {
+        std::size_t pos = std::size_t(hashes[i]);
+        std::size_t idx = (pos < num) ? pos : this->remap_[pos - num];
+        this->entries_[idx] = std::move(src[order[i]]);
+    }
+    return true;
+}
+
+// Getters.
+
+template <typename K, typename V, typename Hash>
+std::size_t FrozenTable<K,V,Hash>::count() {
+    return this->count_;
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t FrozenTable<K,V,Hash>::memory() {
+    return this->entries_.length() * sizeof(Entry) +
+           this->pilots_.length() * sizeof(std::uint16_t) +
+           this->remap_.length() * sizeof(std::size_t);
+}
+
+// @brief           finds entry of key
+// @param key       key to search for
+// @return          entry index, key must still be compared
+template <typename K, typename V, typename Hash>
+std::size_t FrozenTable<K,V,Hash>::locate(const K& key) {
+    std::uint64_t hash = this->hash(key);
+    std::size_t pos = this->position(hash, this->pilots_[this->bucket(hash)]);
+    return (pos < this->count_) ? pos : this->remap_[pos - this->count_];
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Hash>
+V FrozenTable<K,V,Hash>::at(const K& key, bool& found) {
+    const V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           find value stored at specified key, without copying it
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found
+template <typename K, typename V, typename Hash>
+const V* FrozenTable<K,V,Hash>::find(const K& key) {
+    if (this->count_ == 0) return nullptr;
+
+    // keys that were never stored land on some other key's entry
+    Entry& entry = this->entries_[this->locate(key)];
+    return (entry.key == key) ? &entry.val : nullptr;
+}
+
+#endif
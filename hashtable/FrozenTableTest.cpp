@@ -0,0 +1,64 @@
+// @file         - FrozenTableTest.cpp
+// @brief        - Testing read only perfect hash tables frozen from mutable ones
+// @author       - Madhav Malhotra
+// @date         - 2024-01-06
+// @version      - 0.0.0
+// =============================================================================
+
+#include <iostream>
+#include <string>
+#include "./FrozenTable.hpp"
+#include "./LinearProbing.hpp"
+#include "./SeparateChaining.hpp"
+
+int main() {
+    // Test empty table
+    FrozenTable<int, int> empty{};
+    bool found = true;
+    std::cout << "Empty: " << empty.count() << ", " << empty.at(3, found) << " " << found << std::endl;
+
+    // Test freezing a table with removed keys
+    LP_HashTable<int, short> my_map{};
+    for (int i = 0; i < 1000; ++i) my_map.add(i, short(i * 3));
+    for (int i = 0; i < 1000; i += 4) my_map.remove(i);
+    FrozenTable<int, short> frozen = my_map.freeze();
+
+    std::size_t correct = 0;
+    for (int i = -100; i < 1100; ++i) {
+        short val = frozen.at(i, found);
+        bool stored = i >= 0 && i < 1000 && i % 4 != 0;
+        correct += (stored) ? found && val == short(i * 3) : !found;
+    }
+    std::cout << "Frozen: " << frozen.count() << ", correct: " << correct << " of 1200" << std::endl;
+
+    // Test freezing separate chaining with string keys, including one key
+    SC_HashTable<std::string, int> words{};
+    for (int i = 0; i < 300; ++i) words.add("word" + std::to_string(i), i);
+    FrozenTable<std::string, int> frozen_words = words.freeze();
+    std::size_t words_correct = 0;
+    for (int i = 0; i < 300; ++i) {
+        const int* val = frozen_words.find("word" + std::to_string(i));
+        words_correct += val && *val == i;
+    }
+    std::cout << "Frozen words: " << frozen_words.count() << ", correct: " << words_correct;
+    std::cout << ", missing found: " << (frozen_words.find("word300") != nullptr) << std::endl;
+
+    LP_HashTable<int, int> single{};
+    single.add(42, 7);
+    FrozenTable<int, int> frozen_single = single.freeze();
+    std::cout << "Single: " << frozen_single.at(42, found) << " " << found;
+    std::cout << ", " << frozen_single.at(41, found) << " " << found << std::endl;
+
+    // Test copies and memory use
+    FrozenTable<int, short> copied = frozen;
+    std::cout << "Copied: " << copied.count() << ", " << copied.at(5, found) << " " << found << std::endl;
+    FrozenTable<int, short> direct(frozen);
+    const FrozenTable<int, short>& const_frozen = frozen;
+    FrozenTable<int, short> const_copied(const_frozen);
+    direct = copied;
+    std::cout << "Copy constructed: " << direct.count() << " " << const_copied.count();
+    std::cout << ", " << direct.at(5, found) << " " << found << std::endl;
+    std::cout << "Bytes per key: " << double(frozen.memory()) / double(frozen.count()) << std::endl;
+
+    return 0;
+}
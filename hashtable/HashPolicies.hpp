@@ -0,0 +1,276 @@
+// @file         HashPolicies.hpp
+// @brief        Compile time hasher, probing, index reduction and statistics
+//               policies for hash tables
+// @author       Madhav Malhotra
+// @date         2023-12-29
+// @version      0.2.0
+// @since 0.1.0  Statistics policies recording resize count and time
+// @since 0.0.0  Prefetch hint for batched lookups
+// =============================================================================
+
+#ifndef HASHTABLE_HASH_POLICIES_HPP
+#define HASHTABLE_HASH_POLICIES_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+/*
+Hashers - callable as Hash{}(key), like std::hash
+*/
+
+// 64 bit multiply-and-fold mixing, shared by the hashers below
+struct WyMix {
+    static constexpr std::uint64_t P0 = 0xa0761d6478bd642fULL;
+    static constexpr std::uint64_t P1 = 0xe7037ed1a0b428dbULL;
+    static constexpr std::uint64_t P2 = 0x8ebc6af09c88c6e3ULL;
+
+    // @brief           multiplies to 128 bits, folds halves with xor
+    // @param a, b      values to mix
+    // @return          mixed value
+    static std::uint64_t mum(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = __uint128_t(a) * b;
+        return std::uint64_t(r) ^ std::uint64_t(r >> 64);
+#else
+        // portable 64x64 -> 128 multiply from 32 bit halves
+        std::uint64_t ha = a >> 32, la = std::uint32_t(a);
+        std::uint64_t hb = b >> 32, lb = std::uint32_t(b);
+        std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        std::uint64_t t = rl + (rm0 << 32);
+        std::uint64_t c = t < rl;
+        std::uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        std::uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+        return lo ^ hi;
+#endif
+    }
+
+    // @brief           reads up to 8 unaligned bytes
+    // @param p         pointer to first byte
+    // @param num       number of bytes, <= 8
+    // @return          bytes as integer, zero padded
+    static std::uint64_t read(const char* p, std::size_t num) {
+        std::uint64_t v{0};
+        std::memcpy(&v, p, num);
+        return v;
+    }
+
+    // @brief           wyhash style byte string hash
+    // @param p         pointer to first byte
+    // @param len       number of bytes
+    // @return          hash of bytes
+    static std::uint64_t bytes(const char* p, std::size_t len) {
+        std::uint64_t seed = P0 ^ len;
+        std::size_t left = len;
+
+        // 16 bytes per step
+        for (; left > 16; left -= 16, p += 16) {
+            seed = mum(read(p, 8) ^ P1, read(p + 8, 8) ^ seed);
+        }
+
+        // last 1-16 bytes, possibly overlapping the previous step
+        std::uint64_t a{0}, b{0};
+        if (left > 8) {
+            a = read(p, 8);
+            b = read(p + left - 8, 8);
+        } else if (left) {
+            a = read(p, left);
+        }
+        return mum(P1 ^ len, mum(a ^ P1, b ^ seed));
+    }
+};
+
+// Mixing hasher. Unlike std::hash, sequential integers map to scattered
+// values, so tables can use the low bits (MaskReduce) or high bits
+// (FastRangeReduce) of a hash directly.
+template <typename K, typename Enable = void>
+struct MixHash {
+    // any other key type, mix the output of std::hash
+    std::size_t operator()(const K& key) const {
+        return std::size_t(WyMix::mum(std::uint64_t(std::hash<K>{}(key)) ^ WyMix::P0, WyMix::P1));
+    }
+};
+
+template <typename K>
+struct MixHash<K, typename std::enable_if<std::is_integral<K>::value || std::is_enum<K>::value>::type> {
+    std::size_t operator()(K key) const {
+        return std::size_t(WyMix::mum(std::uint64_t(key) ^ WyMix::P0, WyMix::P1));
+    }
+};
+
+template <>
+struct MixHash<std::string> {
+    std::size_t operator()(const std::string& key) const {
+        return std::size_t(WyMix::bytes(key.data(), key.size()));
+    }
+};
+
+
+/*
+Probing - bucket offset of the iter-th probe from a key's base bucket
+*/
+
+// offsets 1, 2, 3, ..., cache friendly but clusters
+struct LinearProbe {
+    static std::size_t offset(std::size_t iter, std::size_t) {
+        return iter;
+    }
+};
+
+// triangular offsets 1, 3, 6, ..., visit every bucket of power of 2 tables
+struct QuadraticProbe {
+    static std::size_t offset(std::size_t iter, std::size_t) {
+        return iter * (iter + 1) / 2;
+    }
+};
+
+// offsets of a per key odd stride, visit every bucket of power of 2 tables
+struct DoubleHashProbe {
+    static std::size_t offset(std::size_t iter, std::size_t hash) {
+        // stride from the high half of the hash, base bucket uses the low half
+        std::size_t stride = (hash >> (sizeof(std::size_t) * 4)) | 1;
+        return iter * stride;
+    }
+};
+
+
+/*
+Reduction - maps a hash, or a base bucket plus probe offset, into the table
+*/
+
+// any bucket count, one integer division per reduction
+struct ModuloReduce {
+    static constexpr bool pow2 = false;
+
+    static std::size_t reduce(std::size_t hash, std::size_t cap) {
+        return hash % cap;
+    }
+
+    static std::size_t wrap(std::size_t idx, std::size_t cap) {
+        // short probe offsets rarely need the division
+        return (idx < cap) ? idx : idx % cap;
+    }
+};
+
+// power of 2 bucket counts, uses low bits of the hash
+struct MaskReduce {
+    static constexpr bool pow2 = true;
+
+    static std::size_t reduce(std::size_t hash, std::size_t cap) {
+        return hash & (cap - 1);
+    }
+
+    static std::size_t wrap(std::size_t idx, std::size_t cap) {
+        return idx & (cap - 1);
+    }
+};
+
+// Lemire's fastrange, any bucket count, uses high bits of the hash.
+// Pair with a mixing hasher, since std::hash of small integers has no high bits.
+struct FastRangeReduce {
+    static constexpr bool pow2 = false;
+
+    static std::size_t reduce(std::size_t hash, std::size_t cap) {
+#if defined(__SIZEOF_INT128__)
+        if constexpr (sizeof(std::size_t) == 8) {
+            return std::size_t((__uint128_t(hash) * cap) >> 64);
+        }
+#endif
+        return std::size_t((std::uint64_t(std::uint32_t(hash)) * cap) >> 32);
+    }
+
+    static std::size_t wrap(std::size_t idx, std::size_t cap) {
+        return (idx < cap) ? idx : idx % cap;
+    }
+};
+
+
+/*
+Statistics - record resizes as Stats::clock() before and Stats::resized(start)
+after. Distributions like probe lengths are measured by scanning the table
+when asked for, so lookups stay read-only and never pay for them.
+*/
+
+// Records nothing. Empty, and every call inlines away, so tables without
+// statistics pay nothing for them.
+struct NoStats {
+    static constexpr bool enabled = false;
+
+    std::uint64_t clock() { return 0; }
+    void resized(std::uint64_t) {}
+    void migrated(std::uint64_t) {}
+    std::size_t resizes() { return 0; }
+    std::uint64_t resize_ns() { return 0; }
+    void reset() {}
+};
+
+// Counts resizes and the total time spent in them, including the buckets
+// an incremental resize migrates during later updates.
+class TableStats {
+    private:
+        std::size_t resizes_{};
+        std::uint64_t resize_ns_{};
+
+    public:
+        static constexpr bool enabled = true;
+
+        // @brief           monotonic time, to pass to resized or migrated
+        // @return          nanoseconds since an arbitrary epoch
+        std::uint64_t clock() {
+            auto since = std::chrono::steady_clock::now().time_since_epoch();
+            return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(since).count());
+        }
+
+        // @brief           records a resize that began at start
+        // @param start     clock() when the resize began
+        void resized(std::uint64_t start) {
+            ++this->resizes_;
+            this->resize_ns_ += this->clock() - start;
+        }
+
+        // @brief           records time spent migrating an unfinished resize
+        // @param start     clock() when the migration step began
+        void migrated(std::uint64_t start) {
+            this->resize_ns_ += this->clock() - start;
+        }
+
+        // @brief           get resize count
+        // @return          number of resizes begun
+        std::size_t resizes() { return this->resizes_; }
+
+        // @brief           get resize time
+        // @return          nanoseconds spent resizing and migrating
+        std::uint64_t resize_ns() { return this->resize_ns_; }
+
+        // @brief           zeroes all counters
+        void reset() {
+            this->resizes_ = 0;
+            this->resize_ns_ = 0;
+        }
+};
+
+
+/*
+Memory hints
+*/
+
+// @brief           hints that memory will be accessed soon, so independent
+//                  cache misses can overlap. No-op without compiler support.
+// @param p         address to fetch
+// @param write     true if the access will be a write
+inline void prefetch(const void* p, bool write = false) {
+#if defined(__GNUC__)
+    if (write) __builtin_prefetch(p, 1, 3);
+    else __builtin_prefetch(p, 0, 3);
+#else
+    (void)p;
+    (void)write;
+#endif
+}
+
+#endif
@@ -2,16 +2,44 @@
 // @brief        Defining a hashtable with open addressing with linear probing
 // @author       Madhav Malhotra
 // @date         2023-12-20
-// @version      0.0.0
+// @version      0.12.0
+// @since 0.11.0 reserve() to size buckets for a known number of entries
+// @since 0.10.0 Optional Bloom front filter so most misses skip probing
+// @since 0.9.0  freeze() into a read only perfect hash table
+// @since 0.8.0  Binary snapshots with save() and load(), see MappedTable.hpp
+//               for serving a snapshot straight from its file
+// @since 0.7.0  Stats policy for resize telemetry, dump_stats() as JSON
+// @since 0.6.0  Forward iterators over live entries replace keys()/values()
+// @since 0.5.0  Batched lookups and additions with prefetching
+// @since 0.4.0  Incremental resize mode, migrating a few buckets per update
+// @since 0.3.0  Backward shift deletion for linear probing, read-only at(),
+//               count excludes tombstones
+// @since 0.2.0  Hasher, probing and reduction policy template parameters
+//               replace std::hash, virtual probe() and modulo
+// @since 0.1.0  Copy/move support, emplace, read-only find, moving rehash
+// @since 0.0.0  Allocator template parameter for bucket array
 // =============================================================================
 
 #ifndef HASHTABLE_LINEAR_PROBING_HPP
 #define HASHTABLE_LINEAR_PROBING_HPP
 
+#include <algorithm>
 #include <iostream>
 #include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "./BloomFilter.hpp"
+#include "./FrozenTable.hpp"
+#include "./HashPolicies.hpp"
 #include "./KeyValue.hpp"
 #include "../array/DynamicArray.hpp"
 
@@ -19,26 +47,252 @@
 Declare class
 */
 
-template <typename K, typename V>
+// Policies are resolved at compile time so the whole probe loop inlines.
+// Hash      - hasher, Hash{}(key), e.g. std::hash or MixHash
+// Probe     - probe sequence, e.g. LinearProbe, QuadraticProbe, DoubleHashProbe
+// Reduce    - hash to bucket mapping, e.g. ModuloReduce, MaskReduce or
+//             FastRangeReduce. MaskReduce keeps a power of 2 bucket count.
+// Stats     - resize telemetry, NoStats or TableStats
+template <typename K, typename V, typename Alloc = std::allocator<KeyValue<K,V>>,
+          typename Hash = std::hash<K>, typename Probe = LinearProbe,
+          typename Reduce = ModuloReduce, typename Stats = NoStats>
 class LP_HashTable {
     protected:
-        DynamicArray< KeyValue<K,V> > arr_{};
+        // initial bucket count
+        static constexpr std::size_t INIT_CAP = (Reduce::pow2) ? 16 : 10;
+
+        // Linear probing removes by shifting later entries back, so buckets
+        // are never tombstones. Other sequences can't tell which later entries
+        // probed past a bucket, so they leave tombstones.
+        static constexpr bool BACKWARD_SHIFT = std::is_same<Probe, LinearProbe>::value;
+
+        // keys hashed and prefetched at once by batched operations, enough
+        // to keep the core's outstanding cache misses busy
+        static constexpr std::size_t BATCH = 16;
+
+        using Buckets = DynamicArray< KeyValue<K,V>, Alloc >;
+
+        Buckets arr_;
         float load_threshold_{0.7};
-        std::size_t count_{};
+        std::size_t count_{};       // live entries, in both arrays while resizing
+        std::size_t tombs_{};       // tombstones in arr_
+
+        // Incremental resizing. While old_ has buckets, entries below
+        // migrated_ have moved to arr_ and left tombstones behind, so probe
+        // paths through old_ stay intact for the entries that haven't.
+        // Between resizes, the null buckets of the next array are staged in
+        // next_ so starting a resize doesn't fill them all at once.
+        Buckets old_;
+        Buckets next_;
+        std::size_t migrated_{};
+        std::size_t resize_step_{};
+
+        // Front filter of every stored key, built only while filter_fpr_
+        // is set, so tables without one don't allocate or size it. Removed
+        // keys keep their bits until the filter is rebuilt, which happens
+        // once its adds reach the number it was sized for.
+        std::optional<BloomFilter<K,Hash>> filter_{};
+        double filter_fpr_{};
+
+        // takes no space with NoStats
+        [[no_unique_address]] Stats stats_{};
 
-        // @brief           hashes input key to index in array.
+        // @brief           hashes input key.
         // @param key       immutable key to hash.
-        // @return          index linked list to add key's val to.
-        std::size_t hash(K key);
+        // @return          full hash, before reduction to a bucket
+        std::size_t hash(const K& key) {
+            return std::size_t(Hash{}(key));
+        }
 
-        // @brief           offsets hash bucket index in collisions
+        // @brief           bucket of a key's probe sequence
+        // @param base      bucket of first probe, Reduce::reduce of hash
+        // @param hash      full hash of key
         // @param iter      iteration of sequence, 0 < iter < infty
-        // @return          0 < offset < infty
-        virtual std::size_t probe(std::size_t iter);
+        // @param cap       number of buckets in probed array
+        // @return          bucket index
+        std::size_t probe(std::size_t base, std::size_t hash, std::size_t iter, std::size_t cap) {
+            return Reduce::wrap(base + Probe::offset(iter, hash), cap);
+        }
+
+        // @brief           finds bucket holding key, without modifying the table
+        // @param key       key to search for
+        // @param hash      full hash of key
+        // @param arr       bucket array to search, arr_ or old_
+        // @return          bucket index, number of buckets if not found
+        std::size_t locate(const K& key, std::size_t hash, Buckets& arr);
+
+        // @brief           number of probes a lookup takes to reach an entry
+        // @param idx       bucket of entry
+        // @param arr       bucket array holding it, arr_ or old_
+        // @return          probes, 1 if the entry is in its home bucket
+        std::size_t probe_length(std::size_t idx, Buckets& arr);
+
+        // @brief           moves key and val into the first free bucket of
+        //                  their probe sequence in arr_. Skips duplicate checks.
+        // @param key       key of new entry, only moved from on success
+        // @param val       val of new entry, only moved from on success
+        // @return          false if the sequence has no free bucket
+        bool place(K& key, V& val);
+
+        // @brief           places an entry known not to be stored, growing
+        //                  arr_ until it fits
+        void insert(K& key, V& val);
+
+        // @brief           moves els into num new buckets, dropping tombstones.
+        //                  With a resize step, only starts the migration.
+        // @param num       number of buckets
+        void rehash(std::size_t num);
+
+        // @brief           moves every el of arr_ into num new buckets at once
+        // @param num       number of buckets
+        void rebuild(std::size_t num);
+
+        // @brief           moves the entries of the next num buckets of old_
+        //                  to arr_, freeing old_ once all have moved
+        // @param num       number of old buckets
+        void migrate(std::size_t num);
+
+        // @brief           fills up to fill more null buckets of next_
+        // @param num       number of buckets next_ needs
+        // @param fill      max number of buckets to fill
+        void stage(std::size_t num, std::size_t fill);
+
+        // @brief           bounded resize work done by each add or remove
+        void advance();
+
+        // @brief           empties a bucket, shifting later entries of its
+        //                  cluster back so none are cut off from home
+        // @param idx       index of bucket to empty
+        void shift_back(std::size_t idx);
+
+        // @brief           adds a stored key to the front filter, rebuilding
+        //                  the filter instead once it's full
+        // @param key       key just stored
+        void filter_add(const K& key);
+
+        // @brief           builds a new front filter of every stored key,
+        //                  sized for half as many again
+        void refilter();
         
     public:
+        // Snapshot file layout: this 64 byte header, then the raw bytes of
+        // every bucket, so a snapshot loads without rehashing. The buckets
+        // are only valid for the same key, value, hasher, probe and
+        // reduction types, which policy fingerprints.
+        struct FileHeader {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t kv_size;      // sizeof(KeyValue<K,V>)
+            std::uint64_t capacity;
+            std::uint64_t count;
+            std::uint64_t tombs;
+            std::uint64_t policy;       // policy_check(), hashers are unseeded
+            std::uint64_t checksum;     // checksum() of the header and buckets
+            float load_threshold;
+            std::uint32_t head_checksum; // head_checksum() of the header
+        };
+        static_assert(sizeof(FileHeader) == 64, "FileHeader must be 64 bytes");
+
+        static constexpr std::uint64_t FILE_MAGIC = 0x454c424154484c50ULL; // "PLHTABLE"
+        static constexpr std::uint32_t FILE_VERSION = 1;
+
+        // @brief           fingerprint of the hasher, probe sequence and
+        //                  reduction, which decide where entries are stored
+        // @return          value saved in and checked against FileHeader
+        static std::uint64_t policy_check();
+
+        // @brief           checksum of a header's fields, so a file opened
+        //                  without reading its buckets still can't trust
+        //                  a corrupt count or load threshold
+        // @param head      header, its two checksums are skipped
+        // @return          value saved in and checked against FileHeader
+        static std::uint32_t head_checksum(const FileHeader& head);
+
+        // @brief           checksum of a header's fields and its buckets' bytes
+        // @param head      header, its checksum field is skipped
+        // @param p_arr     first of head.capacity buckets
+        // @return          value saved in and checked against FileHeader
+        static std::uint64_t checksum(const FileHeader& head, const KeyValue<K,V>* p_arr);
+
+        // @brief           checks a header was written by a table like this one
+        // @param head      header read from a snapshot
+        // @param bytes     size of the snapshot file
+        // @return          false if the header doesn't match the file or types
+        static bool valid_header(const FileHeader& head, std::size_t bytes);
+
+        // Forward iterator over live entries. Walks arr_, then the unmigrated
+        // buckets of old_ while resizing, skipping null buckets and tombstones.
+        // Holds only pointers into the buckets, so it never allocates, and is
+        // invalidated by any addition or removal. Values may be updated
+        // through it, keys must not be.
+        class iterator {
+            private:
+                KeyValue<K,V>* p_cur_{};
+                KeyValue<K,V>* p_end_{};
+                KeyValue<K,V>* p_next_{};       // second range, old_ or empty
+                KeyValue<K,V>* p_next_end_{};
+
+                // @brief       moves to the first live bucket at or after p_cur_
+                void skip() {
+                    while (true) {
+                        while (p_cur_ != p_end_ && (p_cur_->notinit || p_cur_->tomb)) ++p_cur_;
+                        if (p_cur_ != p_end_ || p_next_ == p_next_end_) return;
+                        p_cur_ = p_next_;
+                        p_end_ = p_next_end_;
+                        p_next_ = p_next_end_;
+                    }
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = KeyValue<K,V>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = KeyValue<K,V>*;
+                using reference = KeyValue<K,V>&;
+
+                iterator() = default;
+
+                // @param p_cur     first bucket of first range
+                // @param p_end     past last bucket of first range
+                // @param p_next    first bucket of second range
+                // @param p_next_end past last bucket of second range
+                iterator(pointer p_cur, pointer p_end, pointer p_next, pointer p_next_end)
+                    : p_cur_(p_cur), p_end_(p_end), p_next_(p_next), p_next_end_(p_next_end) {
+                    this->skip();
+                }
+
+                reference operator*() const { return *p_cur_; }
+                pointer operator->() const { return p_cur_; }
+
+                iterator& operator++() {
+                    ++p_cur_;
+                    this->skip();
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator prev = *this;
+                    ++(*this);
+                    return prev;
+                }
+
+                bool operator==(const iterator& other) const { return p_cur_ == other.p_cur_; }
+                bool operator!=(const iterator& other) const { return p_cur_ != other.p_cur_; }
+        };
+
+        // @brief           creates empty hash table with 10 buckets, 16 for
+        //                  power of 2 reduction
+        // @param alloc     allocator for bucket array
+        LP_HashTable(const Alloc& alloc = Alloc{});
+
+        // copy and move. Moved from tables are left empty
+        LP_HashTable(const LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>& other) = default;
+        LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>& operator=(const LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>& other) = default;
+        LP_HashTable(LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>&& other);
+        LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>& operator=(LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>&& other);
+
         // destructor
-        ~LP_HashTable();
+        ~LP_HashTable() = default;
         
         // @brief           get count
         // @return          number of key value pairs in hash table
@@ -52,40 +306,138 @@ class LP_HashTable {
         // @return          current load factor
         float load_factor();
 
-        // @brief           get keys
-        // @param num       output parameter, number of keys
-        // @return          pointer to first key
-        K* keys(std::size_t& num);
-
-        // @brief           get values
-        // @param num       output parameter, number of values
-        // @return          pointer to first value
-        V* values(std::size_t& num);
-
         // @brief                set load factor
         // @param load_threshold    0 < factor <= 1. Recommended range: 0.4-0.7
         void set_load_threshold(float load_threshold);
 
+        // @brief           get resize step
+        // @return          old buckets migrated per add or remove, 0 if
+        //                  resizes rehash every entry at once
+        std::size_t resize_step();
+
+        // @brief           set resize step. With a step, resizing keeps the
+        //                  old buckets and each add or remove moves step of
+        //                  them to the new array, bounding its latency. Lookups
+        //                  check both arrays meanwhile, and never migrate so
+        //                  they stay read-only. Steps of 8 or more always
+        //                  finish before the next resize is due.
+        // @param step      old buckets per update, 0 to rehash all at once
+        void set_resize_step(std::size_t step);
+
+        // @brief           get front filter false positive rate
+        // @return          target rate of the filter, 0 if there's none
+        double filter_fpr();
+
+        // @brief           set front filter. With a rate, a blocked Bloom
+        //                  filter of the keys is checked before probing, so
+        //                  all but that fraction of misses return after one
+        //                  cache line read instead of walking a probe run.
+        //                  Costs about 10 bits per key at 1%, and every add
+        //                  updates it. Worth it when most lookups miss.
+        // @param fpr       0 <= fpr < 1, 0 to drop the filter
+        void set_filter_fpr(double fpr);
+
+        // @brief           checks for an unfinished incremental resize
+        // @return          true if entries are still split across two arrays
+        bool resizing();
+
         // @brief           add a key value pair to the hash table
         // @param key       immutable key for new key value pair
         // @param val       arbitrary data type value for key val pair
         // @return          false if failed for reasons like duplicate keys
         bool add(K key, V val);
 
+        // @brief           add a key with a value constructed from args
+        // @param key       immutable key for new key value pair
+        // @param args      arguments forwarded to V's constructor, only
+        //                  used if the key isn't already stored
+        // @return          false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
         // @brief           remove a key value pair to the hash table
         // @param key       immutable key to find kv pair to remove
         // @return          false if failed for reasons like key not found
-        bool remove(K key);
+        bool remove(const K& key);
 
         // @brief           access value stored at specified key
         // @param key       key to retrieve value from
         // @param found     output parameter, set to false if key not found
         // @return          default val if key not found, else stored val 
-        V at(K key, bool& found);
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found.
+        //                  Invalidated by later additions or removals.
+        V* find(const K& key);
+
+        // @brief           looks up many keys at once. Hashes a batch of keys
+        //                  and prefetches their buckets before probing any, so
+        //                  the cache misses overlap instead of queueing.
+        // @param keys      keys to retrieve values from
+        // @param num       number of keys
+        // @param out_vals  output parameter, num values, default val for
+        //                  keys not found
+        // @param out_found output parameter, num flags, false for keys not found
+        void at_batch(const K* keys, std::size_t num, V* out_vals, bool* out_found);
+
+        // @brief           adds many key value pairs, prefetching the buckets
+        //                  of a batch of keys before adding any
+        // @param keys      keys of new key value pairs
+        // @param vals      values of new key value pairs
+        // @param num       number of pairs
+        // @return          number of pairs added, duplicates are skipped
+        std::size_t add_batch(const K* keys, const V* vals, std::size_t num);
         
         // @brief           moves els to 2x larger array to reduce collisions
         void double_capacity();
 
+        // @brief           grows buckets so num entries fit without another
+        //                  resize, finishing any incremental resize first
+        // @param num       number of entries
+        void reserve(std::size_t num);
+
+        // @brief           get statistics policy, with resize count and time
+        //                  for TableStats
+        // @return          reference to recorded statistics
+        Stats& stats();
+
+        // @brief           writes one line of JSON describing the table:
+        //                  count, capacity, load factor, tombstones, the
+        //                  probe length of every entry as a histogram whose
+        //                  ith element counts entries found after i + 1
+        //                  probes, and resize count and time for TableStats.
+        //                  Scans every bucket.
+        // @param os        stream to write to
+        void dump_stats(std::ostream& os = std::cout);
+
+        // @brief           writes every bucket to a snapshot file, finishing
+        //                  any incremental resize first. Requires trivially
+        //                  copyable keys and values.
+        // @param path      file to create or overwrite
+        void save(const std::string& path);
+
+        // @brief           replaces contents with a snapshot's buckets,
+        //                  without rehashing. Throws, leaving the table
+        //                  unchanged, if the file is corrupt or was saved by
+        //                  a table with other types.
+        // @param path      file written by save
+        void load(const std::string& path);
+
+        // @brief           builds a read only copy of the table over a
+        //                  minimal perfect hash, for tables that stop
+        //                  changing. Lookups probe exactly one entry.
+        // @return          FrozenTable holding copies of every entry
+        FrozenTable<K,V> freeze();
+
+        // @brief           iterator to first live entry, in bucket order
+        iterator begin();
+
+        // @brief           iterator past last live entry
+        iterator end();
+
         // @brief           deletes all elements
         void clear();
 
@@ -98,29 +450,63 @@ class LP_HashTable {
 Define class in hpp file due to template issues
 */
 
-// Destructor, getters, and setters.
-template <typename K, typename V>
-LP_HashTable<K,V>::~LP_HashTable() {
-    this->clear();
+// @brief           creates empty hash table with 10 buckets
+// @param alloc     allocator for bucket array
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::LP_HashTable(const Alloc& alloc)
+    : arr_(INIT_CAP, KeyValue<K,V>{}, alloc), old_(std::size_t(1), alloc),
+      next_(std::size_t(1), alloc) {}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::LP_HashTable(LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>&& other)
+    : arr_(std::move(other.arr_)), load_threshold_(other.load_threshold_),
+      count_(other.count_), tombs_(other.tombs_), old_(std::move(other.old_)),
+      next_(std::move(other.next_)), migrated_(other.migrated_),
+      resize_step_(other.resize_step_), filter_(std::move(other.filter_)),
+      filter_fpr_(other.filter_fpr_), stats_(other.stats_) {
+    other.clear();
+}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>& LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::operator=(LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>&& other) {
+    if (this != &other) {
+        this->arr_ = std::move(other.arr_);
+        this->load_threshold_ = other.load_threshold_;
+        this->count_ = other.count_;
+        this->tombs_ = other.tombs_;
+        this->old_ = std::move(other.old_);
+        this->next_ = std::move(other.next_);
+        this->migrated_ = other.migrated_;
+        this->resize_step_ = other.resize_step_;
+        this->filter_ = std::move(other.filter_);
+        this->filter_fpr_ = other.filter_fpr_;
+        this->stats_ = other.stats_;
+        other.clear();
+    }
+    return *this;
 }
 
-template <typename K, typename V>
-std::size_t LP_HashTable<K,V>::count() {
+// Getters and setters.
+
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::size_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::count() {
     return this->count_;
 }
 
-template <typename K, typename V>
-float LP_HashTable<K,V>::load_threshold() {
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+float LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::load_threshold() {
     return this->load_threshold_;
 }
 
-template <typename K, typename V>
-float LP_HashTable<K,V>::load_factor() {
-    return float(this->count_) / float(this->arr_.capacity());
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+float LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::load_factor() {
+    return float(this->count_) / float(this->arr_.length());
 }
 
-template <typename K, typename V>
-void LP_HashTable<K,V>::set_load_threshold(float load_threshold) {
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::set_load_threshold(float load_threshold) {
     if (load_threshold > 0 && load_threshold <= 1) {
         this->load_threshold_ = load_threshold;
     } else {
@@ -128,183 +514,722 @@ void LP_HashTable<K,V>::set_load_threshold(float load_threshold) {
     }
 }
 
-// @brief           hashes input key to index in array.
-// @param key       immutable key to hash.
-// @return          index linked list to add key's val to.
-template <typename K, typename V>
-std::size_t LP_HashTable<K,V>::hash(K key) {
-    std::size_t hash = std::hash<K>{}(key);
-    return hash % this->arr_.capacity();
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::size_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::resize_step() {
+    return this->resize_step_;
 }
 
-// @brief           offsets hash bucket index in collisions
-// @param iter      iteration of sequence, 0 < iter < infty
-// @return          0 < offset < infty
-template <typename K, typename V>
-std::size_t LP_HashTable<K,V>::probe(std::size_t iter) {
-    return iter;
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::set_resize_step(std::size_t step) {
+    // switching to one shot resizes finishes the current migration
+    if (step == 0) {
+        std::uint64_t start = this->stats_.clock();
+        this->migrate(this->old_.length());
+        this->stats_.migrated(start);
+        this->next_.clear();
+    }
+    this->resize_step_ = step;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+double LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::filter_fpr() {
+    return this->filter_fpr_;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::set_filter_fpr(double fpr) {
+    if (!(fpr >= 0 && fpr < 1)) {
+        throw std::invalid_argument("False positive rate is not in range [0, 1)");
+    }
+    this->filter_fpr_ = fpr;
+    if (fpr > 0) this->refilter();
+    else this->filter_.reset();
+}
+
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::resizing() {
+    return this->old_.length() != 0;
 }
 
 // @brief           add a key value pair to the hash table
 // @param key       immutable key for new key value pair
 // @param val       arbitrary data type value for key val pair
 // @return          false if failed for reasons like duplicate keys
-template <typename K, typename V>
-bool LP_HashTable<K,V>::add(K key, V val) {
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           add a key with a value constructed from args
+// @param key       immutable key for new key value pair
+// @param args      arguments forwarded to V's constructor, only
+//                  used if the key isn't already stored
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+template <typename... Args>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::emplace(K key, Args&&... args) {
+    if (this->resize_step_) this->advance();
+
     // obtain base hash index
-    std::size_t base = this->hash(key);
+    std::size_t cap = this->arr_.length();
+    std::size_t hash = this->hash(key);
+    std::size_t base = Reduce::reduce(hash, cap);
     std::size_t idx = base + 0;
-    KeyValue<K,V> curr = this->arr_.at(base + 0);
+    KeyValue<K,V>* curr = &this->arr_.at(base + 0);
+    KeyValue<K,V>* first_tomb = nullptr;
     std::size_t iter{1};
 
-    // while bucket isn't null or a tombstone,
-    while( !(curr.notinit || curr.tomb) ) {
-        // keep offsetting with probe
-        if (curr.key == key) return false;
-        idx = (base + this->probe(iter)) % this->arr_.capacity();
-        curr = this->arr_.at(idx);
+    // while bucket isn't null,
+    while(!curr->notinit) {
+        // keep offsetting with probe. The key may be stored past a
+        // tombstone, so only remember the first one
+        if (curr->tomb) {
+            if (!first_tomb) first_tomb = curr;
+        } else if (curr->key == key) {
+            return false;
+        }
+
+        // sequences that skip buckets, e.g. quadratic probing without a
+        // power of 2 bucket count, may miss every null one
+        if (iter >= cap) break;
+        idx = this->probe(base, hash, iter, cap);
+        curr = &this->arr_.at(idx);
         ++iter;
     }
 
-    // when empty/tomb bucket found, add value
-    this->count_ += (curr.tomb) ? 0 : 1;
+    // entries that haven't migrated yet are only in the old array
+    if (this->resizing() && this->locate(key, hash, this->old_) < this->old_.length()) {
+        return false;
+    }
+
+    if (first_tomb) {
+        curr = first_tomb;
+        --this->tombs_;
+    } else if (!curr->notinit) {
+        this->double_capacity();
+        return this->emplace(std::move(key), std::forward<Args>(args)...);
+    }
 
-    curr.key = key;
-    curr.val = val;
-    curr.notinit = false;
-    curr.tomb = false;
-    this->arr_.set(curr, idx);
+    // when empty/tomb bucket found, add value in place
+    curr->val = V(std::forward<Args>(args)...);
+    curr->key = std::move(key);
+    curr->notinit = false;
+    curr->tomb = false;
+    ++this->count_;
+    if (this->filter_) this->filter_add(curr->key);
 
-    if (this->load_factor() > this->load_threshold_) this->double_capacity();
+    // tombstones lengthen probes like entries, so count both
+    if (float(this->count_ + this->tombs_) > this->load_threshold_ * float(cap)) {
+        // if clearing tombstones would leave the table under 3/4 of its
+        // threshold, rehash in place so churn doesn't keep growing it
+        if (float(this->count_) < this->load_threshold_ * float(cap) * 0.75f) this->rehash(cap);
+        else this->double_capacity();
+    }
     return true;
 }
 
 // @brief           remove a key value pair to the hash table
 // @param key       immutable key to find kv pair to remove
 // @return          false if failed for reasons like key not found
-template <typename K, typename V>
-bool LP_HashTable<K,V>::remove(K key) {
-    // obtain base hash index
-    std::size_t base = this->hash(key);
-    std::size_t idx = base + 0;
-    KeyValue<K,V> curr = this->arr_.at(idx);
-    std::size_t iter{0};
-
-    // While bucket isn't null,
-    while(!curr.notinit) {
-        // check if key found.
-        if (curr.key == key) {
-            curr.key = K{};
-            curr.val = V{};
-            curr.tomb = true;
-            this->arr_.set(curr, idx);
-            return true;
-        }
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::remove(const K& key) {
+    if (this->resize_step_) this->advance();
 
-        // Check next bucket if not.
-        ++iter;
-        idx = (base + this->probe(iter)) % this->arr_.capacity();
-        curr = this->arr_.at(idx);
+    std::size_t hash = this->hash(key);
+    std::size_t idx = this->locate(key, hash, this->arr_);
+    if (idx == this->arr_.length()) {
+        if (!this->resizing()) return false;
+
+        // old buckets only ever become tombstones, migration relies on
+        // their probe paths staying intact
+        idx = this->locate(key, hash, this->old_);
+        if (idx == this->old_.length()) return false;
+        KeyValue<K,V>& curr = this->old_.at(idx);
+        curr.key = K{};
+        curr.val = V{};
+        curr.tomb = true;
+        --this->count_;
+        return true;
     }
+    --this->count_;
 
-    return false;
+    if constexpr (BACKWARD_SHIFT) {
+        this->shift_back(idx);
+    } else {
+        KeyValue<K,V>& curr = this->arr_.at(idx);
+        curr.key = K{};
+        curr.val = V{};
+        curr.tomb = true;
+        ++this->tombs_;
+    }
+    return true;
+}
+
+// @brief           empties a bucket, shifting later entries of its
+//                  cluster back so none are cut off from home
+// @param idx       index of bucket to empty
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::shift_back(std::size_t idx) {
+    std::size_t cap = this->arr_.length();
+    std::size_t hole = idx;
+    std::size_t next = Reduce::wrap(hole + 1, cap);
+
+    // until the end of the cluster, or back at the hole if the table is
+    // full (load threshold 1) and has no null bucket to end it
+    while (next != hole && !this->arr_.at(next).notinit) {
+        KeyValue<K,V>& curr = this->arr_.at(next);
+        std::size_t home = Reduce::reduce(this->hash(curr.key), cap);
+
+        // entries can move back to the hole if it's still on their probe
+        // path, i.e. the hole is no further from next than their home is
+        std::size_t from_home = (next >= home) ? next - home : next + cap - home;
+        std::size_t from_hole = (next >= hole) ? next - hole : next + cap - hole;
+        if (from_home >= from_hole) {
+            this->arr_.at(hole) = std::move(curr);
+            hole = next;
+        }
+        next = Reduce::wrap(next + 1, cap);
+    }
+
+    KeyValue<K,V>& empty = this->arr_.at(hole);
+    empty.key = K{};
+    empty.val = V{};
+    empty.notinit = true;
+    empty.tomb = false;
+}
+
+// @brief           adds a stored key to the front filter, rebuilding the
+//                  filter instead once it's full
+// @param key       key just stored
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::filter_add(const K& key) {
+    // a rebuild also drops the bits of removed keys, and comes after as
+    // half as many adds as the table holds, so it's amortized like a resize
+    if (this->filter_->count() >= this->filter_->expected()) this->refilter();
+    else this->filter_->add(key);
+}
+
+// @brief           builds a new front filter of every stored key
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::refilter() {
+    std::size_t expected = std::max(this->count_ + this->count_ / 2, std::size_t(64));
+    this->filter_.emplace(expected, this->filter_fpr_);
+    for (KeyValue<K,V>& kv : *this) this->filter_->add(kv.key);
 }
 
 // @brief           access value stored at specified key
 // @param key       key to retrieve value from
 // @param found     output parameter, set to false if key not found
 // @return          default val if key not found, else stored val
-template <typename K, typename V>
-V LP_HashTable<K,V>::at(K key, bool& found) {
-    // obtain base hash index
-    std::size_t base = this->hash(key);
-    KeyValue<K,V> curr = this->arr_.at(base + 0);
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+V LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
 
-    // data to track while offsetting
-    std::size_t iter{1};
-    int first_tomb{-1};
-    std::size_t last_free{0};
-
-    found = false;
-    V val{};
-
-    // While bucket isn't null and key hasn't been found,
-    while(!curr.notinit && !found) {
-        // keep offsetting with probe,
-        std::size_t idx = (base + this->probe(iter)) % this->arr_.capacity();
-        curr = this->arr_.at(idx);
-
-        // until key found.
-        if (curr.key == key) {
-            found = true;
-            val = curr.val;
+// @brief           find value stored at specified key, without
+//                  copying it
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found.
+//                  Invalidated by later additions or removals.
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+V* LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::find(const K& key) {
+    if (this->filter_ && !this->filter_->contains(key)) return nullptr;
+
+    std::size_t hash = this->hash(key);
+    std::size_t idx = this->locate(key, hash, this->arr_);
+    if (idx < this->arr_.length()) return &this->arr_.at(idx).val;
+    if (!this->resizing()) return nullptr;
+
+    idx = this->locate(key, hash, this->old_);
+    return (idx < this->old_.length()) ? &this->old_.at(idx).val : nullptr;
+}
+
+// @brief           looks up many keys at once. Hashes a batch of keys
+//                  and prefetches their buckets before probing any, so
+//                  the cache misses overlap instead of queueing.
+// @param keys      keys to retrieve values from
+// @param num       number of keys
+// @param out_vals  output parameter, num values, default val for
+//                  keys not found
+// @param out_found output parameter, num flags, false for keys not found
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::at_batch(const K* keys, std::size_t num, V* out_vals, bool* out_found) {
+    std::size_t cap = this->arr_.length();
+    KeyValue<K,V>* buckets = this->arr_.data();
+    std::size_t hashes[BATCH];
+    bool passed[BATCH];
+
+    for (std::size_t start = 0; start < num; start += BATCH) {
+        std::size_t len = std::min(BATCH, num - start);
+
+        // issue every home bucket's load first, except for keys the front
+        // filter rules out
+        for (std::size_t i = 0; i < len; ++i) {
+            passed[i] = !this->filter_ || this->filter_->contains(keys[start + i]);
+            hashes[i] = this->hash(keys[start + i]);
+            if (passed[i]) prefetch(buckets + Reduce::reduce(hashes[i], cap));
         }
 
-        // Track the first tombstone and last free bucket found.
-        if (!curr.tomb) last_free = idx;
-        else if (first_tomb < 0) first_tomb = idx;
-
-        // Whenever a first tombstone and last free bucket exist, swap them.
-        if (first_tomb > -1 && last_free > std::size_t(first_tomb) ) {
-            KeyValue<K,V> tomb = this->arr_.at(first_tomb);
-            KeyValue<K,V> last = this->arr_.at(last_free);
-
-            tomb.tomb = false;
-            tomb.key = last.key;
-            tomb.val = last.val;
-            this->arr_.set(tomb, first_tomb);
-            first_tomb = last_free;
-
-            last.key = K{};
-            last.val = V{};
-            last.notinit = false;
-            last.tomb = true;
-            this->arr_.set(last, last_free);
-            last_free = 0;
+        // then probe, most buckets have arrived by now
+        for (std::size_t i = 0; i < len; ++i) {
+            const K& key = keys[start + i];
+            V* val = nullptr;
+            std::size_t idx = (passed[i]) ? this->locate(key, hashes[i], this->arr_) : cap;
+            if (idx < cap) {
+                val = &buckets[idx].val;
+            } else if (passed[i] && this->resizing()) {
+                idx = this->locate(key, hashes[i], this->old_);
+                if (idx < this->old_.length()) val = &this->old_.at(idx).val;
+            }
+
+            out_found[start + i] = val != nullptr;
+            out_vals[start + i] = (val) ? *val : V{};
         }
-        ++iter;
     }
+}
+
+// @brief           adds many key value pairs, prefetching the buckets
+//                  of a batch of keys before adding any
+// @param keys      keys of new key value pairs
+// @param vals      values of new key value pairs
+// @param num       number of pairs
+// @return          number of pairs added, duplicates are skipped
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::size_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::add_batch(const K* keys, const V* vals, std::size_t num) {
+    std::size_t added{0};
+
+    for (std::size_t start = 0; start < num; start += BATCH) {
+        std::size_t len = std::min(BATCH, num - start);
+
+        // additions may resize, so prefetch against the current array
+        // for each batch
+        std::size_t cap = this->arr_.length();
+        KeyValue<K,V>* buckets = this->arr_.data();
+        for (std::size_t i = 0; i < len; ++i) {
+            prefetch(buckets + Reduce::reduce(this->hash(keys[start + i]), cap), true);
+        }
+
+        for (std::size_t i = 0; i < len; ++i) {
+            added += this->emplace(keys[start + i], vals[start + i]);
+        }
+    }
+    return added;
+}
+
+// @brief           finds bucket holding key, without modifying the table
+// @param key       key to search for
+// @param hash      full hash of key
+// @param arr       bucket array to search, arr_ or old_
+// @return          bucket index, number of buckets if not found
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::size_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::locate(const K& key, std::size_t hash, Buckets& arr) {
+    // obtain base hash index
+    std::size_t cap = arr.length();
+    std::size_t base = Reduce::reduce(hash, cap);
+    std::size_t idx = base + 0;
+
+    // stop at the first null bucket, or once every bucket is checked
+    for (std::size_t iter = 1; iter <= cap; ++iter) {
+        KeyValue<K,V>& curr = arr.at(idx);
+        if (curr.notinit) break;
+        if (!curr.tomb && curr.key == key) return idx;
+        idx = this->probe(base, hash, iter, cap);
+    }
+
+    return cap;
+}
+
+// @brief           moves key and val into the first free bucket of
+//                  their probe sequence in arr_. Skips duplicate checks.
+// @param key       key of new entry, only moved from on success
+// @param val       val of new entry, only moved from on success
+// @return          false if the sequence has no free bucket
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::place(K& key, V& val) {
+    std::size_t cap = this->arr_.length();
+    std::size_t hash = this->hash(key);
+    std::size_t base = Reduce::reduce(hash, cap);
+    std::size_t idx = base + 0;
+
+    for (std::size_t iter = 1; iter <= cap; ++iter) {
+        KeyValue<K,V>& curr = this->arr_.at(idx);
+        if (curr.notinit || curr.tomb) {
+            if (curr.tomb) --this->tombs_;
+            curr.key = std::move(key);
+            curr.val = std::move(val);
+            curr.notinit = false;
+            curr.tomb = false;
+            return true;
+        }
+        idx = this->probe(base, hash, iter, cap);
+    }
+
+    return false;
+}
 
-    return val;
+// @brief           places an entry known not to be stored, growing
+//                  arr_ until it fits
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::insert(K& key, V& val) {
+    while (!this->place(key, val)) this->rebuild(this->arr_.length() * 2);
 }
 
 // @brief           moves els to 2x larger array to reduce collisions
-template <typename K, typename V>
-void LP_HashTable<K,V>::double_capacity() {
-    // create new array
-    std::size_t cap = this->arr_.capacity();
-    DynamicArray<KeyValue<K,V>> old = this->arr_;
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::double_capacity() {
+    this->rehash(this->arr_.length() * 2);
+}
 
-    this->arr_ = DynamicArray<KeyValue<K,V>>(cap * 2);
-    this->count_ = 0;
+// @brief           grows buckets so num entries fit without another resize
+// @param num       number of entries
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::reserve(std::size_t num) {
+    this->migrate(this->old_.length());
+
+    // doubling keeps power of 2 counts for MaskReduce
+    std::size_t cap = this->arr_.length();
+    while (float(num) > this->load_threshold_ * float(cap)) cap *= 2;
+    if (cap == this->arr_.length()) return;
+
+    this->next_.clear();
+    this->rebuild(cap);
+}
+
+// @brief           moves els into num new buckets, dropping tombstones.
+//                  With a resize step, only starts the migration.
+// @param num       number of buckets
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::rehash(std::size_t num) {
+    if (this->resize_step_ == 0) {
+        this->rebuild(num);
+        return;
+    }
+
+    // a resize that starts before the last finished completes it first,
+    // and fills whatever is left of the next array
+    std::uint64_t start = this->stats_.clock();
+    this->migrate(this->old_.length());
+    this->stage(num, num);
+
+    this->old_ = std::move(this->arr_);
+    this->arr_ = std::move(this->next_);
+    this->tombs_ = 0;
+    this->migrated_ = 0;
+    this->migrate(this->resize_step_);
+    this->stats_.resized(start);
+}
+
+// @brief           moves every el of arr_ into num new buckets at once
+// @param num       number of buckets
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::rebuild(std::size_t num) {
+    // take old buckets, then create new array
+    std::uint64_t start = this->stats_.clock();
+    std::size_t cap = this->arr_.length();
+    Buckets old(std::move(this->arr_));
+
+    this->arr_ = Buckets(num, KeyValue<K,V>{}, old.get_allocator());
+    this->tombs_ = 0;
 
     for (std::size_t i = 0; i < cap; ++i) {
-        KeyValue<K,V> curr = old.at(i);
+        KeyValue<K,V>& curr = old.at(i);
         if (!(curr.notinit || curr.tomb)) {
-            this->add(curr.key, curr.val);
+            this->insert(curr.key, curr.val);
+        }
+    }
+    this->stats_.resized(start);
+}
+
+// @brief           moves the entries of the next num buckets of old_
+//                  to arr_, freeing old_ once all have moved
+// @param num       number of old buckets
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::migrate(std::size_t num) {
+    std::size_t cap = this->old_.length();
+    std::size_t end = std::min(this->migrated_ + num, cap);
+
+    for (; this->migrated_ < end; ++this->migrated_) {
+        KeyValue<K,V>& curr = this->old_.at(this->migrated_);
+        if (curr.notinit || curr.tomb) continue;
+
+        this->insert(curr.key, curr.val);
+        curr.key = K{};
+        curr.val = V{};
+        curr.tomb = true;
+    }
+
+    if (cap && this->migrated_ == cap) {
+        this->old_.clear();
+        this->migrated_ = 0;
+    }
+}
+
+// @brief           fills up to fill more null buckets of next_
+// @param num       number of buckets next_ needs
+// @param fill      max number of buckets to fill
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::stage(std::size_t num, std::size_t fill) {
+    // reserving only maps memory, pages are touched as buckets are filled
+    if (this->next_.capacity() != num) {
+        this->next_ = Buckets(num, this->arr_.get_allocator());
+    }
+    std::size_t len = this->next_.length();
+    if (len < num) this->next_.resize(std::min(len + fill, num), KeyValue<K,V>{});
+}
+
+// @brief           bounded resize work done by each add or remove
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::advance() {
+    if (this->resizing()) {
+        std::uint64_t start = this->stats_.clock();
+        this->migrate(this->resize_step_);
+        this->stats_.migrated(start);
+    } else {
+        // a growth is due after at least load_threshold_ / 2 * cap adds
+        // and fills 2 * cap buckets, 8 / load_threshold_ per update leaves
+        // slack for the migration before it
+        this->stage(this->arr_.length() * 2, std::size_t(8.0f / this->load_threshold_));
+    }
+}
+
+// @brief           number of probes a lookup takes to reach an entry
+// @param idx       bucket of entry
+// @param arr       bucket array holding it, arr_ or old_
+// @return          probes, 1 if the entry is in its home bucket
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::size_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::probe_length(std::size_t idx, Buckets& arr) {
+    std::size_t hash = this->hash(arr.at(idx).key);
+    std::size_t cap = arr.length();
+    std::size_t base = Reduce::reduce(hash, cap);
+
+    // entries were placed along their sequence, so it reaches idx
+    std::size_t iter = 0;
+    for (std::size_t curr = base; curr != idx && iter < cap; ) {
+        curr = this->probe(base, hash, ++iter, cap);
+    }
+    return iter + 1;
+}
+
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+Stats& LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::stats() {
+    return this->stats_;
+}
+
+// @brief           writes one line of JSON describing the table
+// @param os        stream to write to
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::dump_stats(std::ostream& os) {
+    // probes[i] counts entries found after i + 1 probes
+    DynamicArray<std::size_t> probes(std::size_t(16));
+    std::size_t tombs{0}, total{0};
+
+    Buckets* arrs[2] = {&this->arr_, &this->old_};
+    for (Buckets* arr : arrs) {
+        // buckets of old_ below migrated_ are tombstones left by the resize
+        std::size_t first = (arr == &this->old_) ? this->migrated_ : 0;
+        for (std::size_t i = first; i < arr->length(); ++i) {
+            KeyValue<K,V>& curr = arr->at(i);
+            if (curr.notinit) continue;
+            if (curr.tomb) {
+                ++tombs;
+                continue;
+            }
+
+            std::size_t len = this->probe_length(i, *arr);
+            if (probes.length() < len) probes.resize(len, 0);
+            ++probes.at(len - 1);
+            total += len;
         }
     }
 
-    // update array
-    old.clear();
-    std::cout << "info: doubled hash table capacity" << std::endl;
+    os << "{\"count\": " << this->count_ << ", \"capacity\": " << this->arr_.length();
+    os << ", \"load_factor\": " << this->load_factor() << ", \"tombstones\": " << tombs;
+    os << ", \"resizing\": " << (this->resizing() ? "true" : "false");
+    os << ", \"max_probe\": " << probes.length() << ", \"mean_probe\": ";
+    os << ((this->count_) ? double(total) / double(this->count_) : 0.0);
+    os << ", \"probe_lengths\": [";
+    for (std::size_t i = 0; i < probes.length(); ++i) {
+        os << ((i) ? ", " : "") << probes.at(i);
+    }
+    os << "]";
+    if constexpr (Stats::enabled) {
+        os << ", \"resizes\": " << this->stats_.resizes();
+        os << ", \"resize_ms\": " << double(this->stats_.resize_ns()) / 1e6;
+    }
+    os << "}" << std::endl;
+}
+
+// @brief           fingerprint of the hasher, probe sequence and reduction
+// @return          value saved in and checked against FileHeader
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::uint64_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::policy_check() {
+    // arbitrary inputs, the reduction to 1000 buckets tells mask, modulo
+    // and fastrange apart
+    std::uint64_t hash = std::uint64_t(Hash{}(K{}));
+    std::uint64_t probe = std::uint64_t(Probe::offset(3, 0x9e3779b97f4a7c15ULL));
+    std::uint64_t reduce = std::uint64_t(Reduce::reduce(0x9e3779b97f4a7c15ULL, 1000));
+    return WyMix::mum(hash ^ WyMix::P0, (probe << 32) ^ reduce ^ WyMix::P1);
+}
+
+// @brief           checksum of a header's fields
+// @param head      header, its two checksums are skipped
+// @return          value saved in and checked against FileHeader
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::uint32_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::head_checksum(const FileHeader& head) {
+    FileHeader fields = head;
+    fields.checksum = 0;
+    fields.head_checksum = 0;
+    return std::uint32_t(WyMix::bytes(reinterpret_cast<const char*>(&fields), sizeof(fields)));
+}
+
+// @brief           checksum of a header's fields and its buckets' bytes
+// @param head      header, its checksum field is skipped
+// @param p_arr     first of head.capacity buckets
+// @return          value saved in and checked against FileHeader
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+std::uint64_t LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::checksum(const FileHeader& head, const KeyValue<K,V>* p_arr) {
+    FileHeader fields = head;
+    fields.checksum = 0;
+    std::uint64_t head_bytes = WyMix::bytes(reinterpret_cast<const char*>(&fields), sizeof(fields));
+    std::uint64_t bucket_bytes = WyMix::bytes(reinterpret_cast<const char*>(p_arr),
+                                              std::size_t(head.capacity) * sizeof(KeyValue<K,V>));
+    return WyMix::mum(head_bytes ^ WyMix::P0, bucket_bytes ^ WyMix::P1);
+}
+
+// @brief           checks a header was written by a table like this one
+// @param head      header read from a snapshot
+// @param bytes     size of the snapshot file
+// @return          false if the header doesn't match the file or types
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+bool LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::valid_header(const FileHeader& head, std::size_t bytes) {
+    // the range check also rejects a NaN load threshold
+    return head.magic == FILE_MAGIC && head.version == FILE_VERSION &&
+           head.head_checksum == head_checksum(head) &&
+           head.kv_size == sizeof(KeyValue<K,V>) && head.policy == policy_check() &&
+           head.load_threshold > 0 && head.load_threshold <= 1 &&
+           head.capacity > 0 && head.capacity <= bytes / sizeof(KeyValue<K,V>) &&
+           head.count + head.tombs <= head.capacity &&
+           bytes == sizeof(FileHeader) + head.capacity * sizeof(KeyValue<K,V>);
+}
+
+// @brief           writes every bucket to a snapshot file
+// @param path      file to create or overwrite
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::save(const std::string& path) {
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "LP_HashTable::save requires trivially copyable keys and values");
+
+    // a snapshot holds one bucket array
+    this->migrate(this->old_.length());
+
+    std::size_t cap = this->arr_.length();
+    FileHeader head{FILE_MAGIC, FILE_VERSION, std::uint32_t(sizeof(KeyValue<K,V>)), cap,
+                    this->count_, this->tombs_, policy_check(), 0, this->load_threshold_, 0};
+    head.head_checksum = head_checksum(head);
+    head.checksum = checksum(head, this->arr_.data());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&head), sizeof(head));
+    file.write(reinterpret_cast<const char*>(this->arr_.data()), std::streamsize(cap * sizeof(KeyValue<K,V>)));
+    file.close();
+    if (!file) {
+        throw std::system_error(std::make_error_code(std::errc::io_error), "save " + path);
+    }
+}
+
+// @brief           replaces contents with a snapshot's buckets
+// @param path      file written by save
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::load(const std::string& path) {
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "LP_HashTable::load requires trivially copyable keys and values");
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::system_error(std::make_error_code(std::errc::io_error), "load " + path);
+    }
+    std::size_t bytes = std::size_t(file.tellg());
+    file.seekg(0);
+
+    FileHeader head{};
+    std::error_code invalid = std::make_error_code(std::errc::invalid_argument);
+    if (bytes < sizeof(head) || !file.read(reinterpret_cast<char*>(&head), sizeof(head)) ||
+        !valid_header(head, bytes)) {
+        throw std::system_error(invalid, "Invalid hash table file " + path);
+    }
+
+    // read into new buckets, so a corrupt file leaves this table unchanged
+    Buckets arr(std::size_t(head.capacity), KeyValue<K,V>{}, this->arr_.get_allocator());
+    file.read(reinterpret_cast<char*>(arr.data()), std::streamsize(head.capacity * sizeof(KeyValue<K,V>)));
+    if (!file || checksum(head, arr.data()) != head.checksum) {
+        throw std::system_error(invalid, "Invalid hash table file " + path);
+    }
+
+    this->clear();
+    this->arr_ = std::move(arr);
+    this->count_ = std::size_t(head.count);
+    this->tombs_ = std::size_t(head.tombs);
+    this->load_threshold_ = head.load_threshold;
+    if (this->filter_fpr_ > 0) this->refilter();
+}
+
+// @brief           builds a read only copy of the table over a
+//                  minimal perfect hash
+// @return          FrozenTable holding copies of every entry
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+FrozenTable<K,V> LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::freeze() {
+    return FrozenTable<K,V>(*this);
+}
+
+// @brief           iterator to first live entry, in bucket order
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+typename LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::iterator LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::begin() {
+    KeyValue<K,V>* p_arr = this->arr_.data();
+    KeyValue<K,V>* p_arr_end = p_arr + this->arr_.length();
+    if (!this->resizing()) return iterator(p_arr, p_arr_end, p_arr_end, p_arr_end);
+
+    // buckets of old_ below migrated_ are all tombstones
+    KeyValue<K,V>* p_old = this->old_.data();
+    return iterator(p_arr, p_arr_end, p_old + this->migrated_, p_old + this->old_.length());
+}
+
+// @brief           iterator past last live entry
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+typename LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::iterator LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::end() {
+    Buckets& last = (this->resizing()) ? this->old_ : this->arr_;
+    KeyValue<K,V>* p_end = last.data() + last.length();
+    return iterator(p_end, p_end, p_end, p_end);
 }
 
 // @brief           removes all stored data in the hashtable
-template <typename K, typename V>
-void LP_HashTable<K,V>::clear() {
-    this->arr_.clear();
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::clear() {
+    // restore the initial empty buckets so the table stays usable
+    this->arr_ = Buckets(INIT_CAP, KeyValue<K,V>{}, this->arr_.get_allocator());
     this->count_ = 0;
+    this->tombs_ = 0;
+    this->old_.clear();
+    this->next_.clear();
+    this->migrated_ = 0;
+    if (this->filter_fpr_ > 0) this->refilter();
 }
 
 // @brief           pretty print hashtable elements
-template <typename K, typename V>
-void LP_HashTable<K,V>::print() {
-    std::size_t cap = this->arr_.capacity();
+template <typename K, typename V, typename Alloc, typename Hash, typename Probe, typename Reduce, typename Stats>
+void LP_HashTable<K,V,Alloc,Hash,Probe,Reduce,Stats>::print() {
+    std::size_t cap = this->arr_.length();
     for (std::size_t i = 0; i < cap; ++i) {
         std::cout << this->arr_.at(i);
     }
     std::cout << std::endl;
+
+    // entries that haven't migrated yet
+    for (std::size_t i = this->migrated_; i < this->old_.length(); ++i) {
+        std::cout << this->old_.at(i);
+    }
+    if (this->resizing()) std::cout << std::endl;
 }
 
 
@@ -7,6 +7,7 @@
 
 #include <random>
 #include <iostream>
+#include <string>
 #include "./LinearProbing.hpp"
 
 int main() {
@@ -62,6 +63,129 @@ int main() {
     my_map.print();
     std::cout << "Increased size: " << my_map.count() << std::endl;
 
+    // test lookups by pointer, copies and moves
+    short* p_val = my_map.find(idx);
+    std::cout << "Found by pointer: " << (p_val ? *p_val : -1);
+    std::cout << ", missing: " << (my_map.find(idx-2) == nullptr) << std::endl;
+
+    LP_HashTable<int, short> map_copy(my_map);
+    LP_HashTable<int, short> map_moved(std::move(map_copy));
+    std::cout << "Moved size: " << map_moved.count();
+    std::cout << ", source size: " << map_copy.count() << std::endl;
+    map_copy.emplace(5, 7);
+    std::cout << "Source reusable: " << *map_copy.find(5) << std::endl;
+
+    // test churn at constant size, removal must not grow the table
+    LP_HashTable<int, short> churn_map{};
+    std::size_t churn_found = 0;
+    for (int i = 0; i < 10000; ++i) {
+        churn_map.add(i, i);
+        if (i >= 20) churn_map.remove(i - 20);
+    }
+    for (int i = 0; i < 10000; ++i) churn_found += churn_map.find(i) != nullptr;
+    std::cout << "Churn size: " << churn_map.count() << ", found: " << churn_found;
+    std::cout << ", load factor: " << churn_map.load_factor() << std::endl;
+
+    // test policies, every key must stay reachable through growth
+    using Alloc = std::allocator<KeyValue<int, short>>;
+    LP_HashTable<int, short, Alloc, MixHash<int>, QuadraticProbe, MaskReduce> quad_map{};
+    LP_HashTable<int, short, Alloc, MixHash<int>, DoubleHashProbe, FastRangeReduce> dbl_map{};
+    std::size_t policy_found = 0;
+    for (int i = 0; i < 1000; ++i) {
+        quad_map.add(i << 4, i);
+        dbl_map.add(i << 4, i);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        policy_found += quad_map.find(i << 4) != nullptr;
+        policy_found += dbl_map.find(i << 4) != nullptr;
+    }
+    std::cout << "Found with policies: " << policy_found << std::endl;
+
+    LP_HashTable<std::string, int, std::allocator<KeyValue<std::string, int>>,
+                 MixHash<std::string>, LinearProbe, MaskReduce> str_map{};
+    str_map.add("seventeen chars..", 17);
+    str_map.add("short", 5);
+    std::cout << "String keys: " << *str_map.find("seventeen chars..");
+    std::cout << " " << *str_map.find("short") << std::endl;
+
+    // test incremental resizing, keys stay reachable mid migration
+    LP_HashTable<int, short> step_map{};
+    step_map.set_resize_step(4);
+    std::size_t resizing_ops = 0, mid_missing = 0, step_found = 0;
+    for (int i = 0; i < 1000; ++i) {
+        step_map.add(i, i);
+        if (i % 3 == 0) step_map.remove(i / 3);
+        if (step_map.resizing()) {
+            ++resizing_ops;
+            for (int j = i / 3 + 1; j <= i; ++j) mid_missing += step_map.find(j) == nullptr;
+        }
+    }
+    for (int i = 0; i < 1000; ++i) step_found += step_map.find(i) != nullptr;
+    std::cout << "Stepped resize: " << (resizing_ops > 0) << ", missing mid migration: ";
+    std::cout << mid_missing << ", size: " << step_map.count();
+    std::cout << ", found: " << step_found << std::endl;
+
+    // test batched additions and lookups, batches span several chunks
+    LP_HashTable<int, short> batch_map{};
+    int batch_keys[40]{};
+    short batch_vals[40]{};
+    bool batch_found[40]{};
+    for (int i = 0; i < 40; ++i) {
+        batch_keys[i] = (i < 35) ? i * 3 : 3;
+        batch_vals[i] = short(i);
+    }
+    std::size_t batch_added = batch_map.add_batch(batch_keys, batch_vals, 40);
+    for (int i = 0; i < 40; ++i) batch_keys[i] = i * 2;
+    batch_map.at_batch(batch_keys, 40, batch_vals, batch_found);
+    std::size_t batch_hits = 0, batch_correct = 0;
+    for (int i = 0; i < 40; ++i) {
+        batch_hits += batch_found[i];
+        batch_correct += (batch_found[i]) ? batch_vals[i] == i * 2 / 3 : batch_vals[i] == 0;
+    }
+    std::cout << "Batch added: " << batch_added << ", hits: " << batch_hits;
+    std::cout << ", correct: " << batch_correct << std::endl;
+
+    // test iteration, including entries left in the old array mid resize
+    LP_HashTable<int, int> iter_map{};
+    iter_map.set_resize_step(1);
+    std::size_t iter_resizing = 0, iter_num = 0;
+    long long iter_sum = 0;
+    for (int i = 0; i < 300; ++i) {
+        iter_map.add(i, i);
+        if (i % 5 == 0) iter_map.remove(i / 5);
+        if (iter_map.resizing()) {
+            ++iter_resizing;
+            std::size_t num = 0;
+            for (KeyValue<int, int>& kv : iter_map) num += kv.key == kv.val;
+            iter_num += num == iter_map.count();
+        }
+    }
+    for (auto it = iter_map.begin(); it != iter_map.end(); ++it) it->val *= 2;
+    for (KeyValue<int, int>& kv : iter_map) iter_sum += kv.val;
+    std::cout << "Iterated while resizing: " << (iter_resizing > 0 && iter_num == iter_resizing);
+    std::cout << ", value sum: " << iter_sum << std::endl;
+
+    // test statistics, dump_stats() scans the table, TableStats counts resizes
+    LP_HashTable<int, int> stats_map{};
+    for (int i = 0; i < 12; ++i) stats_map.add(i * 10, i);
+    stats_map.remove(20);
+    stats_map.dump_stats();
+    LP_HashTable<int, int, std::allocator<KeyValue<int, int>>, std::hash<int>, LinearProbe, ModuloReduce, TableStats> timed_map{};
+    for (int i = 0; i < 1000; ++i) timed_map.add(i, i);
+    std::cout << "Resizes: " << timed_map.stats().resizes() << std::endl;
+
+    // test removal from a full table, which has no null bucket
+    LP_HashTable<int, int> full_map{};
+    full_map.set_load_threshold(1.0);
+    for (int i = 0; i < 10; ++i) full_map.add(i, i);
+    std::cout << "Full table load: " << full_map.load_factor();
+    std::cout << ", removed: " << full_map.remove(3) << " " << full_map.remove(3);
+    std::cout << ", count: " << full_map.count() << std::endl;
+    full_map.add(13, 13);
+    bool full_found = false;
+    std::cout << "After refill: " << full_map.at(13, full_found) << " " << full_found;
+    std::cout << ", " << full_map.at(9, full_found) << " " << full_found << std::endl;
+
     my_map.clear();
     std::cout << "Final size: " << my_map.count() << std::endl;
 
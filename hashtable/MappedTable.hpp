@@ -0,0 +1,236 @@
+// @file         MappedTable.hpp
+// @brief        Defining a read only hashtable served straight from a memory
+//               mapped LP_HashTable snapshot
+// @author       Madhav Malhotra
+// @date         2024-01-05
+// @version      0.0.0
+// @note         Linux only. Buckets are never copied, pages are read from
+//               the file the first time a lookup touches them.
+// =============================================================================
+
+#ifndef HASHTABLE_MAPPED_TABLE_HPP
+#define HASHTABLE_MAPPED_TABLE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "./HashPolicies.hpp"
+#include "./KeyValue.hpp"
+#include "./LinearProbing.hpp"
+
+/*
+Declare class
+*/
+
+// Opens a file written by LP_HashTable::save. Hash, Probe and Reduce must
+// match the saved table's, which the file's policy fingerprint checks.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename Probe = LinearProbe, typename Reduce = ModuloReduce>
+class LP_MappedTable {
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "LP_MappedTable requires trivially copyable keys and values");
+
+    private:
+        // header layout, checks and checksum are the saving table's
+        using Table = LP_HashTable<K, V, std::allocator<KeyValue<K,V>>, Hash, Probe, Reduce>;
+        using FileHeader = typename Table::FileHeader;
+
+        std::string path_{};
+        int fd_{-1};
+        unsigned char* p_map_{};
+        std::size_t map_bytes_{};
+        const KeyValue<K,V>* p_arr_{};
+        std::size_t cap_{};
+        std::size_t count_{};
+
+        // @brief           unmaps and closes file, then throws errno as an error
+        // @param what      name of failed call
+        [[noreturn]] void fail(const std::string& what);
+
+        // @brief           finds bucket holding key
+        // @param key       key to search for
+        // @return          bucket index, number of buckets if not found
+        std::size_t locate(const K& key);
+
+    public:
+        // @brief           maps a snapshot read only, this is open_mapped.
+        //                  Throws if the file is corrupt or was saved by a
+        //                  table with other types.
+        // @param path      file written by LP_HashTable::save
+        // @param verify    checks the buckets' checksum, reading the whole
+        //                  file. Without it, opening reads only the header,
+        //                  which is still checked against its own checksum.
+        LP_MappedTable(const std::string& path, bool verify = true);
+
+        // a mapping has one owner
+        LP_MappedTable(const LP_MappedTable<K,V,Hash,Probe,Reduce>& other) = delete;
+        LP_MappedTable<K,V,Hash,Probe,Reduce>& operator=(const LP_MappedTable<K,V,Hash,Probe,Reduce>& other) = delete;
+
+        // @brief           takes other's mapping, leaving it empty
+        LP_MappedTable(LP_MappedTable<K,V,Hash,Probe,Reduce>&& other);
+
+        // @brief           unmaps and closes file
+        ~LP_MappedTable();
+
+        // @brief           get count
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           get capacity
+        // @return          number of buckets in file
+        std::size_t capacity();
+
+        // @brief           access value stored at specified key
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer into the mapping, nullptr if key not found
+        const V* find(const K& key);
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           unmaps and closes file, then throws errno as an error
+// @param what      name of failed call
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+void LP_MappedTable<K,V,Hash,Probe,Reduce>::fail(const std::string& what) {
+    int err = errno;
+    if (this->p_map_) {
+        munmap(this->p_map_, this->map_bytes_);
+        this->p_map_ = nullptr;
+    }
+    if (this->fd_ >= 0) {
+        close(this->fd_);
+        this->fd_ = -1;
+    }
+    throw std::system_error(err, std::generic_category(), what + " " + this->path_);
+}
+
+// @brief           maps a snapshot read only
+// @param path      file written by LP_HashTable::save
+// @param verify    checks the buckets' checksum, reading the whole file.
+//                  The header is always checked.
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+LP_MappedTable<K,V,Hash,Probe,Reduce>::LP_MappedTable(const std::string& path, bool verify) : path_(path) {
+    this->fd_ = open(path.c_str(), O_RDONLY);
+    if (this->fd_ < 0) {
+        this->fail("open");
+    }
+
+    struct stat st{};
+    if (fstat(this->fd_, &st) != 0) {
+        this->fail("fstat");
+    }
+    this->map_bytes_ = static_cast<std::size_t>(st.st_size);
+    if (this->map_bytes_ < sizeof(FileHeader)) {
+        errno = EINVAL;
+        this->fail("Invalid hash table file");
+    }
+
+    void* p_map = mmap(nullptr, this->map_bytes_, PROT_READ, MAP_SHARED, this->fd_, 0);
+    if (p_map == MAP_FAILED) {
+        this->fail("mmap");
+    }
+    this->p_map_ = static_cast<unsigned char*>(p_map);
+
+    // buckets start 64 bytes into a page aligned mapping, so they're aligned
+    const FileHeader* p_head = reinterpret_cast<const FileHeader*>(this->p_map_);
+    this->p_arr_ = reinterpret_cast<const KeyValue<K,V>*>(this->p_map_ + sizeof(FileHeader));
+    if (!Table::valid_header(*p_head, this->map_bytes_) ||
+        (verify && Table::checksum(*p_head, this->p_arr_) != p_head->checksum)) {
+        errno = EINVAL;
+        this->fail("Invalid hash table file");
+    }
+    this->cap_ = std::size_t(p_head->capacity);
+    this->count_ = std::size_t(p_head->count);
+}
+
+// @brief           takes other's mapping, leaving it empty
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+LP_MappedTable<K,V,Hash,Probe,Reduce>::LP_MappedTable(LP_MappedTable<K,V,Hash,Probe,Reduce>&& other)
+    : path_(std::move(other.path_)), fd_(std::exchange(other.fd_, -1)),
+      p_map_(std::exchange(other.p_map_, nullptr)), map_bytes_(std::exchange(other.map_bytes_, 0)),
+      p_arr_(std::exchange(other.p_arr_, nullptr)), cap_(std::exchange(other.cap_, 0)),
+      count_(std::exchange(other.count_, 0)) {}
+
+// @brief           unmaps and closes file
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+LP_MappedTable<K,V,Hash,Probe,Reduce>::~LP_MappedTable() {
+    if (this->p_map_) munmap(this->p_map_, this->map_bytes_);
+    if (this->fd_ >= 0) close(this->fd_);
+}
+
+// Getters.
+
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+std::size_t LP_MappedTable<K,V,Hash,Probe,Reduce>::count() {
+    return this->count_;
+}
+
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+std::size_t LP_MappedTable<K,V,Hash,Probe,Reduce>::capacity() {
+    return this->cap_;
+}
+
+// @brief           finds bucket holding key
+// @param key       key to search for
+// @return          bucket index, number of buckets if not found
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+std::size_t LP_MappedTable<K,V,Hash,Probe,Reduce>::locate(const K& key) {
+    // same probe sequence as LP_HashTable::locate
+    std::size_t cap = this->cap_;
+    std::size_t hash = std::size_t(Hash{}(key));
+    std::size_t base = Reduce::reduce(hash, cap);
+    std::size_t idx = base + 0;
+
+    for (std::size_t iter = 1; iter <= cap; ++iter) {
+        const KeyValue<K,V>& curr = this->p_arr_[idx];
+        if (curr.notinit) break;
+        if (!curr.tomb && curr.key == key) return idx;
+        idx = Reduce::wrap(base + Probe::offset(iter, hash), cap);
+    }
+
+    return cap;
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+V LP_MappedTable<K,V,Hash,Probe,Reduce>::at(const K& key, bool& found) {
+    const V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           find value stored at specified key, without copying it
+// @param key       key to retrieve value from
+// @return          pointer into the mapping, nullptr if key not found
+template <typename K, typename V, typename Hash, typename Probe, typename Reduce>
+const V* LP_MappedTable<K,V,Hash,Probe,Reduce>::find(const K& key) {
+    // a moved from table has no buckets
+    if (this->cap_ == 0) return nullptr;
+    std::size_t idx = this->locate(key);
+    return (idx < this->cap_) ? &this->p_arr_[idx].val : nullptr;
+}
+
+#endif
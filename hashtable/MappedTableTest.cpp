@@ -0,0 +1,121 @@
+// @file         - MappedTableTest.cpp
+// @brief        - Testing hash table snapshots, loaded into a table and
+//                 served straight from a mapped file
+// @author       - Madhav Malhotra
+// @date         - 2024-01-05
+// @version      - 0.0.0
+// =============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include "./HashPolicies.hpp"
+#include "./LinearProbing.hpp"
+#include "./MappedTable.hpp"
+
+int main() {
+    const std::string path = "/tmp/MappedTableTest.bin";
+    std::remove(path.c_str());
+
+    // save a table with tombstones from quadratic probing
+    using A = std::allocator<KeyValue<int, long long>>;
+    using Table = LP_HashTable<int, long long, A, MixHash<int>, QuadraticProbe, MaskReduce>;
+    Table my_map{};
+    for (int i = 0; i < 500; ++i) my_map.add(i, i * 11LL);
+    for (int i = 0; i < 500; i += 5) my_map.remove(i);
+    my_map.save(path);
+    std::cout << "Saved: " << my_map.count() << std::endl;
+
+    // load without rehashing, then keep using the table
+    Table loaded{};
+    loaded.add(-1, 0);
+    loaded.load(path);
+    std::size_t correct = 0;
+    for (int i = 0; i < 500; ++i) {
+        bool found = false;
+        long long val = loaded.at(i, found);
+        correct += (i % 5) ? found && val == i * 11LL : !found;
+    }
+    loaded.add(1000, 1);
+    std::cout << "Loaded: " << loaded.count() << ", correct: " << correct;
+    std::cout << ", added after: " << (loaded.find(1000) != nullptr) << std::endl;
+
+    // serve lookups from the mapping
+    {
+        LP_MappedTable<int, long long, MixHash<int>, QuadraticProbe, MaskReduce> mapped(path);
+        std::size_t mapped_correct = 0;
+        for (int i = 0; i < 500; ++i) {
+            bool found = false;
+            long long val = mapped.at(i, found);
+            mapped_correct += (i % 5) ? found && val == i * 11LL : !found;
+        }
+        std::cout << "Mapped: " << mapped.count() << ", capacity: " << mapped.capacity();
+        std::cout << ", correct: " << mapped_correct << std::endl;
+
+        LP_MappedTable<int, long long, MixHash<int>, QuadraticProbe, MaskReduce> moved(std::move(mapped));
+        std::cout << "Moved: " << moved.count() << ", source finds: " << (mapped.find(1) != nullptr) << std::endl;
+    }
+
+    // other policies are rejected
+    try {
+        LP_MappedTable<int, long long> wrong(path);
+    } catch (const std::system_error& e) {
+        std::cout << "Caught wrong policies" << std::endl;
+    }
+
+    // corrupt header fields are rejected, even when the buckets aren't read
+    for (std::size_t offset : {24, 56}) {
+        my_map.save(path);
+        {
+            // count, then load threshold
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(std::streamoff(offset));
+            if (offset == 24) {
+                std::uint64_t count = 7;
+                file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            } else {
+                float threshold = 0.0f;
+                file.write(reinterpret_cast<const char*>(&threshold), sizeof(threshold));
+            }
+        }
+        std::size_t caught = 0;
+        try {
+            loaded.load(path);
+        } catch (const std::system_error& e) {
+            ++caught;
+        }
+        for (bool verify : {true, false}) {
+            try {
+                LP_MappedTable<int, long long, MixHash<int>, QuadraticProbe, MaskReduce> corrupt(path, verify);
+            } catch (const std::system_error& e) {
+                ++caught;
+            }
+        }
+        std::cout << "Caught corrupt header at " << offset << ": " << caught;
+        std::cout << ", size: " << loaded.count() << std::endl;
+    }
+    my_map.save(path);
+
+    // a flipped byte fails the checksum, and loading leaves the table as is
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(200);
+        file.put('\x5a');
+    }
+    try {
+        loaded.load(path);
+    } catch (const std::system_error& e) {
+        std::cout << "Caught corrupt load, size: " << loaded.count() << std::endl;
+    }
+    try {
+        LP_MappedTable<int, long long, MixHash<int>, QuadraticProbe, MaskReduce> corrupt(path);
+    } catch (const std::system_error& e) {
+        std::cout << "Caught corrupt mapping" << std::endl;
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,377 @@
+// @file         RobinHood.hpp
+// @brief        Defining a hashtable with open addressing and Robin Hood
+//               linear probing
+// @author       Madhav Malhotra
+// @date         2023-12-27
+// @version      0.0.0
+// =============================================================================
+
+#ifndef HASHTABLE_ROBIN_HOOD_HPP
+#define HASHTABLE_ROBIN_HOOD_HPP
+
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "../array/DynamicArray.hpp"
+
+/*
+Declare class
+*/
+
+// key value pair that also stores how far it was probed from its home bucket
+template <typename K, typename V>
+struct RH_KeyValue {
+    K key{};
+    V val{};
+    // probe distance + 1, 0 marks an empty bucket
+    std::uint32_t dist{0};
+};
+
+template <typename K, typename V>
+std::ostream& operator<<(std::ostream& os, const RH_KeyValue<K,V>& kv) {
+    if (!kv.dist) os << "null, ";
+    else os << kv.key << ": " << kv.val << ", ";
+    return os;
+}
+
+// Robin Hood hashing: on insert, an entry takes the bucket of any entry that
+// is closer to its own home bucket. Probe distances stay short and even, so
+// lookups stop as soon as they've probed further than the bucket's entry did,
+// and the table can run at higher load than LP_HashTable. Removal shifts later
+// entries back instead of leaving tombstones.
+template <typename K, typename V, typename Alloc = std::allocator<RH_KeyValue<K,V>>>
+class RH_HashTable {
+    protected:
+        DynamicArray< RH_KeyValue<K,V>, Alloc > arr_;
+        float load_threshold_{0.9};
+        std::size_t count_{};
+
+        // @brief           hashes input key to index in array.
+        // @param key       immutable key to hash.
+        // @return          home bucket of key.
+        std::size_t hash(const K& key);
+
+        // @brief           finds bucket holding key
+        // @param key       key to search for
+        // @return          bucket index, number of buckets if not found
+        std::size_t locate(const K& key);
+
+        // @brief           places entry by Robin Hood order, no duplicate
+        //                  checks or resizing
+        // @param kv        entry to place, dist is set here
+        void place(RH_KeyValue<K,V>&& kv);
+
+    public:
+        // @brief           creates empty hash table with 10 buckets
+        // @param alloc     allocator for bucket array
+        RH_HashTable(const Alloc& alloc = Alloc{});
+
+        // copy and move. Moved from tables are left empty with 10 buckets
+        RH_HashTable(const RH_HashTable<K,V,Alloc>& other) = default;
+        RH_HashTable<K,V,Alloc>& operator=(const RH_HashTable<K,V,Alloc>& other) = default;
+        RH_HashTable(RH_HashTable<K,V,Alloc>&& other);
+        RH_HashTable<K,V,Alloc>& operator=(RH_HashTable<K,V,Alloc>&& other);
+
+        // destructor
+        ~RH_HashTable() = default;
+
+        // @brief           get count
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           get load threshold (max kv pairs / hash table capacity)
+        // @return          load threshold setting
+        float load_threshold();
+
+        // @brief           get load factor (current kv pairs / hash table capacity)
+        // @return          current load factor
+        float load_factor();
+
+        // @brief                set load factor
+        // @param load_threshold    0 < factor <= 1. Recommended range: 0.7-0.95
+        void set_load_threshold(float load_threshold);
+
+        // @brief           get longest probe sequence of any stored key
+        // @return          max number of buckets a lookup may check
+        std::size_t max_probe();
+
+        // @brief           add a key value pair to the hash table
+        // @param key       immutable key for new key value pair
+        // @param val       arbitrary data type value for key val pair
+        // @return          false if failed for reasons like duplicate keys
+        bool add(K key, V val);
+
+        // @brief           add a key with a value constructed from args
+        // @param key       immutable key for new key value pair
+        // @param args      arguments forwarded to V's constructor, only
+        //                  used if the key isn't already stored
+        // @return          false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
+        // @brief           remove a key value pair from the hash table
+        // @param key       immutable key to find kv pair to remove
+        // @return          false if failed for reasons like key not found
+        bool remove(const K& key);
+
+        // @brief           access value stored at specified key
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found.
+        //                  Invalidated by later additions or removals.
+        V* find(const K& key);
+
+        // @brief           moves els to 2x larger array to reduce collisions
+        void double_capacity();
+
+        // @brief           deletes all elements
+        void clear();
+
+        // @brief           pretty prints saved data to console
+        void print();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates empty hash table with 10 buckets
+// @param alloc     allocator for bucket array
+template <typename K, typename V, typename Alloc>
+RH_HashTable<K,V,Alloc>::RH_HashTable(const Alloc& alloc)
+    : arr_(std::size_t(10), RH_KeyValue<K,V>{}, alloc) {}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc>
+RH_HashTable<K,V,Alloc>::RH_HashTable(RH_HashTable<K,V,Alloc>&& other)
+    : arr_(std::move(other.arr_)), load_threshold_(other.load_threshold_),
+      count_(other.count_) {
+    other.clear();
+}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc>
+RH_HashTable<K,V,Alloc>& RH_HashTable<K,V,Alloc>::operator=(RH_HashTable<K,V,Alloc>&& other) {
+    if (this != &other) {
+        this->arr_ = std::move(other.arr_);
+        this->load_threshold_ = other.load_threshold_;
+        this->count_ = other.count_;
+        other.clear();
+    }
+    return *this;
+}
+
+// Getters and setters.
+template <typename K, typename V, typename Alloc>
+std::size_t RH_HashTable<K,V,Alloc>::count() {
+    return this->count_;
+}
+
+template <typename K, typename V, typename Alloc>
+float RH_HashTable<K,V,Alloc>::load_threshold() {
+    return this->load_threshold_;
+}
+
+template <typename K, typename V, typename Alloc>
+float RH_HashTable<K,V,Alloc>::load_factor() {
+    return float(this->count_) / float(this->arr_.length());
+}
+
+template <typename K, typename V, typename Alloc>
+void RH_HashTable<K,V,Alloc>::set_load_threshold(float load_threshold) {
+    if (load_threshold > 0 && load_threshold <= 1) {
+        this->load_threshold_ = load_threshold;
+    } else {
+        throw std::invalid_argument("Load factor is not in range (0, 1]");
+    }
+}
+
+// @brief           get longest probe sequence of any stored key
+// @return          max number of buckets a lookup may check
+template <typename K, typename V, typename Alloc>
+std::size_t RH_HashTable<K,V,Alloc>::max_probe() {
+    std::size_t longest{0};
+    for (RH_KeyValue<K,V>& kv : this->arr_) {
+        longest = (kv.dist > longest) ? kv.dist : longest;
+    }
+    return longest;
+}
+
+// @brief           hashes input key to index in array.
+// @param key       immutable key to hash.
+// @return          home bucket of key.
+template <typename K, typename V, typename Alloc>
+std::size_t RH_HashTable<K,V,Alloc>::hash(const K& key) {
+    std::size_t hash = std::hash<K>{}(key);
+    return hash % this->arr_.length();
+}
+
+// @brief           finds bucket holding key
+// @param key       key to search for
+// @return          bucket index, number of buckets if not found
+template <typename K, typename V, typename Alloc>
+std::size_t RH_HashTable<K,V,Alloc>::locate(const K& key) {
+    std::size_t cap = this->arr_.length();
+    std::size_t idx = this->hash(key);
+
+    // a stored key is never further from home than the entries it passed,
+    // so stop once this probe is longer than the bucket's own
+    for (std::uint32_t dist = 1; ; ++dist) {
+        RH_KeyValue<K,V>& curr = this->arr_.at(idx);
+        if (curr.dist < dist) return cap;
+        if (curr.key == key) return idx;
+        idx = (idx + 1 == cap) ? 0 : idx + 1;
+    }
+}
+
+// @brief           places entry by Robin Hood order, no duplicate
+//                  checks or resizing
+// @param kv        entry to place, dist is set here
+template <typename K, typename V, typename Alloc>
+void RH_HashTable<K,V,Alloc>::place(RH_KeyValue<K,V>&& kv) {
+    std::size_t cap = this->arr_.length();
+    std::size_t idx = this->hash(kv.key);
+    kv.dist = 1;
+
+    while (true) {
+        RH_KeyValue<K,V>& curr = this->arr_.at(idx);
+
+        // empty bucket ends the chain of displacements
+        if (!curr.dist) {
+            curr = std::move(kv);
+            return;
+        }
+
+        // take from the rich: entry closer to home gives up its bucket
+        // and continues probing in place of kv
+        if (curr.dist < kv.dist) {
+            using std::swap;
+            swap(curr, kv);
+        }
+
+        idx = (idx + 1 == cap) ? 0 : idx + 1;
+        ++kv.dist;
+    }
+}
+
+// @brief           add a key value pair to the hash table
+// @param key       immutable key for new key value pair
+// @param val       arbitrary data type value for key val pair
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc>
+bool RH_HashTable<K,V,Alloc>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           add a key with a value constructed from args
+// @param key       immutable key for new key value pair
+// @param args      arguments forwarded to V's constructor, only
+//                  used if the key isn't already stored
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc>
+template <typename... Args>
+bool RH_HashTable<K,V,Alloc>::emplace(K key, Args&&... args) {
+    if (this->locate(key) < this->arr_.length()) return false;
+
+    // grow first, so placing always finds an empty bucket
+    if (float(this->count_ + 1) > this->load_threshold_ * float(this->arr_.length())) {
+        this->double_capacity();
+    }
+
+    this->place(RH_KeyValue<K,V>{std::move(key), V(std::forward<Args>(args)...), 0});
+    ++this->count_;
+    return true;
+}
+
+// @brief           remove a key value pair from the hash table
+// @param key       immutable key to find kv pair to remove
+// @return          false if failed for reasons like key not found
+template <typename K, typename V, typename Alloc>
+bool RH_HashTable<K,V,Alloc>::remove(const K& key) {
+    std::size_t cap = this->arr_.length();
+    std::size_t idx = this->locate(key);
+    if (idx == cap) return false;
+
+    // backward shift: pull each following displaced entry one bucket closer
+    // to home, until an empty bucket or an entry already at home
+    std::size_t next = (idx + 1 == cap) ? 0 : idx + 1;
+    while (this->arr_.at(next).dist > 1) {
+        this->arr_.at(idx) = std::move(this->arr_.at(next));
+        --this->arr_.at(idx).dist;
+        idx = next;
+        next = (next + 1 == cap) ? 0 : next + 1;
+    }
+    this->arr_.at(idx) = RH_KeyValue<K,V>{};
+
+    --this->count_;
+    return true;
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Alloc>
+V RH_HashTable<K,V,Alloc>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           find value stored at specified key, without
+//                  copying it
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found.
+//                  Invalidated by later additions or removals.
+template <typename K, typename V, typename Alloc>
+V* RH_HashTable<K,V,Alloc>::find(const K& key) {
+    std::size_t idx = this->locate(key);
+    return (idx < this->arr_.length()) ? &this->arr_.at(idx).val : nullptr;
+}
+
+// @brief           moves els to 2x larger array to reduce collisions
+template <typename K, typename V, typename Alloc>
+void RH_HashTable<K,V,Alloc>::double_capacity() {
+    // take old buckets, then create new array
+    std::size_t cap = this->arr_.length();
+    DynamicArray<RH_KeyValue<K,V>, Alloc> old(std::move(this->arr_));
+
+    this->arr_ = DynamicArray<RH_KeyValue<K,V>, Alloc>(cap * 2, RH_KeyValue<K,V>{}, old.get_allocator());
+
+    for (std::size_t i = 0; i < cap; ++i) {
+        RH_KeyValue<K,V>& curr = old.at(i);
+        if (curr.dist) this->place(std::move(curr));
+    }
+}
+
+// @brief           removes all stored data in the hashtable
+template <typename K, typename V, typename Alloc>
+void RH_HashTable<K,V,Alloc>::clear() {
+    // restore the initial 10 empty buckets so the table stays usable
+    this->arr_ = DynamicArray<RH_KeyValue<K,V>, Alloc>(std::size_t(10), RH_KeyValue<K,V>{}, this->arr_.get_allocator());
+    this->count_ = 0;
+}
+
+// @brief           pretty print hashtable elements
+template <typename K, typename V, typename Alloc>
+void RH_HashTable<K,V,Alloc>::print() {
+    std::size_t cap = this->arr_.length();
+    for (std::size_t i = 0; i < cap; ++i) {
+        std::cout << this->arr_.at(i);
+    }
+    std::cout << std::endl;
+}
+
+
+#endif
@@ -0,0 +1,72 @@
+// @file         - RobinHoodTest.cpp
+// @brief        - Testing a hashtable with open addressing and Robin Hood probing
+// @author       - Madhav Malhotra
+// @date         - 2023-12-27
+// @version      - 0.0.0
+// =============================================================================
+
+#include <random>
+#include <iostream>
+#include "./RobinHood.hpp"
+
+int main() {
+    // Test initialisation
+    RH_HashTable<int, short> my_map{};
+    std::cout << "Init" << std::endl;
+    
+    std::cout << "Old load threshold: " << my_map.load_threshold() << std::endl;
+    my_map.set_load_threshold(0.95);
+    std::cout << "New load threshold: " << my_map.load_threshold() << std::endl;
+
+    // Test data addition
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(1,10000000);
+    std::size_t idx = 0;
+    std::size_t indices[28]{};
+
+    for (std::size_t i = 0; i < 28; ++i) {
+        idx = dist(gen);
+        indices[i] = idx;
+        my_map.add(idx, i);
+    }
+    std::cout << "Duplicate added: " << my_map.add(idx, 0) << std::endl;
+
+    my_map.print();
+    std::cout << "Count after addition: " << my_map.count();
+    std::cout <<  ", Load factor: " << my_map.load_factor();
+    std::cout <<  ", Max probe: " << my_map.max_probe() << std::endl;
+    
+    // Test retrieval
+    bool found = false;
+    std::cout << my_map.at(idx, found) << " " << found << std::endl;
+    std::cout << my_map.at(idx-2, found) << " " << found << std::endl;
+
+    // Test removal, remaining keys must still be found after shifting
+    std::cout << "Removing indices: ";
+    for (std::size_t i = 10; i < 19; ++i) {
+        bool removed = my_map.remove(indices[i]);
+        if (removed) std::cout << indices[i] << ", ";
+    }
+    std::cout << std::endl << "After removal: "; 
+    my_map.print();
+
+    std::size_t still_found = 0;
+    for (std::size_t i = 0; i < 28; ++i) {
+        still_found += my_map.find(indices[i]) != nullptr;
+    }
+    std::cout << "Still found: " << still_found << std::endl;
+
+    std::cout << my_map.remove(dist(gen)) << std::endl;
+    std::cout << "Size: " << my_map.count() << std::endl;
+
+    // Test moving and reuse after clearing
+    RH_HashTable<int, short> map_moved(std::move(my_map));
+    std::cout << "Moved size: " << map_moved.count();
+    std::cout << ", source size: " << my_map.count() << std::endl;
+
+    map_moved.clear();
+    map_moved.emplace(5, 7);
+    std::cout << "Final size: " << map_moved.count() << std::endl;
+
+    return 0;
+}
@@ -2,16 +2,30 @@
 // @brief        - Defining a hashtable using separate chaining for collisions
 // @author       - Madhav Malhotra
 // @date         - 2023-12-17
-// @version      - 0.0.0
+// @version      - 0.7.0
+// @since 0.6.0  - freeze() into a read only perfect hash table
+// @since 0.5.0  - Stats policy for resize telemetry, dump_stats() as JSON
+// @since 0.4.0  - Forward iterators over stored pairs
+// @since 0.3.0  - Batched lookups and additions with prefetching
+// @since 0.2.0  - Incremental resize mode, migrating a few buckets per update
+// @since 0.1.0  - Copy/move support, emplace, read-only find, moving rehash
+// @since 0.0.0  - Allocator template parameter for buckets, lists and nodes
 // =============================================================================
 
 #ifndef HASHTABLE_SEPARATE_CHAINING_HPP3
 #define HASHTABLE_SEPARATE_CHAINING_HPP3
 
+#include <algorithm>
 #include <iostream>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "./FrozenTable.hpp"
+#include "./HashPolicies.hpp"
 #include "./KeyValue.hpp"
 #include "../array/DynamicArray.hpp"
 #include "../linkedlist/SinglyLinkedList.hpp"
@@ -20,46 +34,296 @@
 Declare class
 */
 
-template <typename K, typename V>
+// Stats     - resize telemetry, NoStats or TableStats
+template <typename K, typename V, typename Alloc = std::allocator<KeyValue<K,V>>,
+          typename Stats = NoStats>
 class SC_HashTable {
     private:
+        using List = SLList<KeyValue<K,V>, Alloc>;
+        using ListAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<List>;
+        using ListTraits = std::allocator_traits<ListAlloc>;
+        using BucketAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<List*>;
+        using Buckets = DynamicArray< List*, BucketAlloc >;
+
+        // keys hashed and prefetched at once by batched operations
+        static constexpr std::size_t BATCH = 16;
+
         // array of pointers to linked lists that hold key val pairs
-        DynamicArray< SLList<KeyValue<K,V>>* > arr_{};
+        Alloc alloc_{};
+        Buckets arr_;
         std::size_t max_depth_{5};
-        std::size_t count_{};
+        std::size_t count_{};           // pairs in both arrays while resizing
+
+        // incremental resizing, buckets of old_ below migrated_ have moved
+        // to arr_ and are null. Between resizes, null buckets of the next
+        // array are staged in next_ a few at a time.
+        Buckets old_;
+        Buckets next_;
+        std::size_t migrated_{};
+        std::size_t resize_step_{};
+
+        // takes no space with NoStats
+        [[no_unique_address]] Stats stats_{};
+
+        // @brief           - allocates and constructs an empty list
+        // @return          - pointer to new list
+        List* create_list();
+
+        // @brief           - destroys and deallocates a list and its nodes
+        // @param list      - pointer to list, from create_list
+        void destroy_list(List* list);
+
+        // @brief           - destroys every list, leaving null buckets, and
+        //                    frees the old array of an unfinished resize
+        void destroy_lists();
+
+        // @brief           - deep copies the lists of src into dst
+        // @param dst       - null buckets, as many as src has
+        // @param src       - buckets to copy
+        void copy_lists(Buckets& dst, Buckets& src);
+
+        // @brief           - copies every list of other table into memory
+        //                    from alloc
+        // @param other     - table to copy
+        // @param alloc     - allocator of the copy
+        SC_HashTable(const SC_HashTable<K,V,Alloc,Stats>& other, const Alloc& alloc);
+
+        // @brief           - frees this table's lists, then takes other's,
+        //                    leaving it empty
+        // @param other     - table whose lists this allocator can free
+        // Adopt            - also take other's allocator
+        template <bool Adopt>
+        void take(SC_HashTable<K,V,Alloc,Stats>& other);
 
         // @brief           - hashes input key to index in array.
         // @param key       - immutable key to hash.
         // @return          - index linked list to add key's val to.
-        std::size_t hash(K key);
+        std::size_t hash(const K& key);
+
+        // @brief           - finds list of an unmigrated key in old_
+        // @param key       - immutable key to hash.
+        // @return          - list key would be in, nullptr if none
+        List* old_list(const K& key);
+
+        // @brief           - finds key in a list
+        // @param list      - list to search, may be nullptr
+        // @param key       - key to search for
+        // @return          - pointer to stored val, nullptr if not found
+        V* find_in(List* list, const K& key);
+
+        // @brief           - removes key from a list
+        // @param list      - list to search, may be nullptr
+        // @param key       - key to remove
+        // @return          - false if key not found
+        bool remove_from(List* list, const K& key);
+
+        // @brief           - moves the pairs of the next num buckets of old_
+        //                    to arr_, freeing old_ once all have moved
+        // @param num       - number of old buckets
+        void migrate(std::size_t num);
+
+        // @brief           - fills up to fill more null buckets of next_
+        // @param num       - number of buckets next_ needs
+        // @param fill      - max number of buckets to fill
+        void stage(std::size_t num, std::size_t fill);
+
+        // @brief           - bounded resize work done by each add or remove
+        void advance();
         
     public:
+        // Forward iterator over stored pairs. Walks the lists of arr_, then
+        // the unmigrated lists of old_ while resizing. Holds a bucket pointer
+        // and a node pointer, so it never allocates, and is invalidated by
+        // any addition or removal. Values may be updated through it, keys
+        // must not be.
+        class iterator {
+            private:
+                List** p_bucket_{};
+                List** p_end_{};
+                List** p_next_{};               // second range, old_ or empty
+                List** p_next_end_{};
+                SLNode<KeyValue<K,V>>* p_node_{};
+
+                // @brief       - moves to the head of the first non empty
+                //                list at or after p_bucket_
+                void skip() {
+                    while (true) {
+                        while (p_bucket_ != p_end_ && !(*p_bucket_ && (*p_bucket_)->head())) ++p_bucket_;
+                        if (p_bucket_ != p_end_) {
+                            p_node_ = (*p_bucket_)->head();
+                            return;
+                        }
+                        if (p_next_ == p_next_end_) return;
+                        p_bucket_ = p_next_;
+                        p_end_ = p_next_end_;
+                        p_next_ = p_next_end_;
+                    }
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = KeyValue<K,V>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = KeyValue<K,V>*;
+                using reference = KeyValue<K,V>&;
+
+                iterator() = default;
+
+                // @param p_bucket  - first bucket of first range
+                // @param p_end     - past last bucket of first range
+                // @param p_next    - first bucket of second range
+                // @param p_next_end - past last bucket of second range
+                iterator(List** p_bucket, List** p_end, List** p_next, List** p_next_end)
+                    : p_bucket_(p_bucket), p_end_(p_end), p_next_(p_next), p_next_end_(p_next_end) {
+                    this->skip();
+                }
+
+                reference operator*() const { return p_node_->getData(); }
+                pointer operator->() const { return &p_node_->getData(); }
+
+                iterator& operator++() {
+                    p_node_ = p_node_->getNext();
+                    if (!p_node_) {
+                        ++p_bucket_;
+                        this->skip();
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator prev = *this;
+                    ++(*this);
+                    return prev;
+                }
+
+                // node pointers differ between lists, and are null at the end
+                bool operator==(const iterator& other) const { return p_node_ == other.p_node_; }
+                bool operator!=(const iterator& other) const { return p_node_ != other.p_node_; }
+        };
+
+        // @brief           - creates empty hash table with 10 buckets
+        // @param alloc     - allocator for buckets, lists and their nodes
+        SC_HashTable(const Alloc& alloc = Alloc{});
+
+        // @brief           - copies every list of other table
+        SC_HashTable(const SC_HashTable<K,V,Alloc,Stats>& other);
+
+        // @brief           - replaces contents with copies of other table's
+        SC_HashTable<K,V,Alloc,Stats>& operator=(const SC_HashTable<K,V,Alloc,Stats>& other);
+
+        // @brief           - takes other table's lists, leaving it empty
+        //                    with 10 buckets
+        SC_HashTable(SC_HashTable<K,V,Alloc,Stats>&& other);
+
+        // @brief           - takes other table's lists, leaving it empty
+        //                    with 10 buckets
+        SC_HashTable<K,V,Alloc,Stats>& operator=(SC_HashTable<K,V,Alloc,Stats>&& other);
+
         // destructor, getters, and setters
         ~SC_HashTable();
         std::size_t count();
         std::size_t max_depth();
         void set_max_depth(std::size_t depth);
 
+        // @brief           - get resize step
+        // @return          - old buckets migrated per add or remove, 0 if
+        //                    resizes rehash every pair at once
+        std::size_t resize_step();
+
+        // @brief           - set resize step. With a step, resizing keeps the
+        //                    old buckets and each add or remove moves step of
+        //                    them to the new array, bounding its latency.
+        //                    Lookups check both arrays meanwhile, and never
+        //                    migrate so they stay read-only.
+        // @param step      - old buckets per update, 0 to rehash all at once
+        void set_resize_step(std::size_t step);
+
+        // @brief           - checks for an unfinished incremental resize
+        // @return          - true if pairs are still split across two arrays
+        bool resizing();
+
         // @brief           - add a key value pair to the hash table
         // @param key       - immutable key for new key value pair
         // @param val       - arbitrary data type value for key val pair
         // @return          - false if failed for reasons like duplicate keys
         bool add(K key, V val);
 
+        // @brief           - add a key with a value constructed from args
+        // @param key       - immutable key for new key value pair
+        // @param args      - arguments forwarded to V's constructor, only
+        //                    used if the key isn't already stored
+        // @return          - false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
         // @brief           - remove a key value pair to the hash table
         // @param key       - immutable key to find kv pair to remove
         // @return          - false if failed for reasons like key not found
-        bool remove(K key);
+        bool remove(const K& key);
 
         // @brief           - access value stored at specified key
         // @param key       - key to retrieve value from
         // @param found     - output parameter, set to false if key not found
         // @return          - default val if key not found, else stored val 
-        V at(K key, bool& found);
+        V at(const K& key, bool& found);
+
+        // @brief           - find value stored at specified key, without
+        //                    copying it
+        // @param key       - key to retrieve value from
+        // @return          - pointer to stored val, nullptr if key not found.
+        //                    Stays valid until the key is removed or its
+        //                    pair is rehashed.
+        V* find(const K& key);
+
+        // @brief           - looks up many keys at once. Walks a batch of keys
+        //                    from bucket to list to first node one level at a
+        //                    time, prefetching the next level for all of them,
+        //                    so the cache misses overlap instead of queueing.
+        // @param keys      - keys to retrieve values from
+        // @param num       - number of keys
+        // @param out_vals  - output parameter, num values, default val for
+        //                    keys not found
+        // @param out_found - output parameter, num flags, false for keys
+        //                    not found
+        void at_batch(const K* keys, std::size_t num, V* out_vals, bool* out_found);
+
+        // @brief           - adds many key value pairs, prefetching the
+        //                    buckets of a batch of keys before adding any
+        // @param keys      - keys of new key value pairs
+        // @param vals      - values of new key value pairs
+        // @param num       - number of pairs
+        // @return          - number of pairs added, duplicates are skipped
+        std::size_t add_batch(const K* keys, const V* vals, std::size_t num);
         
-        // @brief           - moves els to 2x larger array to reduce collisions
+        // @brief           - moves els to 2x larger array to reduce collisions.
+        //                    With a resize step, only starts the migration.
         void double_capacity();
 
+        // @brief           - get statistics policy, with resize count and
+        //                    time for TableStats
+        // @return          - reference to recorded statistics
+        Stats& stats();
+
+        // @brief           - writes one line of JSON describing the table:
+        //                    count, capacity, load factor, the length of
+        //                    every chain as a histogram whose ith element
+        //                    counts buckets holding i pairs, and resize
+        //                    count and time for TableStats. Scans every bucket.
+        // @param os        - stream to write to
+        void dump_stats(std::ostream& os = std::cout);
+
+        // @brief           - builds a read only copy of the table over a
+        //                    minimal perfect hash, for tables that stop
+        //                    changing. Lookups probe exactly one entry.
+        // @return          - FrozenTable holding copies of every pair
+        FrozenTable<K,V> freeze();
+
+        // @brief           - iterator to first pair, in bucket order
+        iterator begin();
+
+        // @brief           - iterator past last pair
+        iterator end();
+
         // @brief           - deletes all elements
         void clear();
 
@@ -72,68 +336,258 @@ class SC_HashTable {
 Define class - in hpp file due to template issues
 */
 
+// @brief           - creates empty hash table with 10 buckets
+// @param alloc     - allocator for buckets, lists and their nodes
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>::SC_HashTable(const Alloc& alloc)
+    : alloc_(alloc), arr_(std::size_t(10), nullptr, BucketAlloc(alloc)),
+      old_(std::size_t(1), BucketAlloc(alloc)), next_(std::size_t(1), BucketAlloc(alloc)) {}
+
+// @brief           - copies every list of other table
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>::SC_HashTable(const SC_HashTable<K,V,Alloc,Stats>& other)
+    : SC_HashTable(other, std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc_)) {}
+
+// @brief           - copies every list of other table into memory from alloc
+// @param other     - table to copy
+// @param alloc     - allocator of the copy
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>::SC_HashTable(const SC_HashTable<K,V,Alloc,Stats>& other, const Alloc& alloc)
+    : alloc_(alloc), arr_(std::size_t(10), BucketAlloc(alloc)),
+      max_depth_(other.max_depth_), count_(other.count_),
+      old_(std::size_t(1), BucketAlloc(alloc)),
+      next_(std::size_t(1), BucketAlloc(alloc)), migrated_(other.migrated_),
+      resize_step_(other.resize_step_), stats_(other.stats_) {
+    // accessors aren't const, other is only read from
+    SC_HashTable<K,V,Alloc,Stats>& src_table = const_cast<SC_HashTable<K,V,Alloc,Stats>&>(other);
+    this->arr_.resize(src_table.arr_.length(), nullptr);
+    this->old_.resize(src_table.old_.length(), nullptr);
+    try {
+        this->copy_lists(this->arr_, src_table.arr_);
+        this->copy_lists(this->old_, src_table.old_);
+    } catch (...) {
+        this->destroy_lists();
+        throw;
+    }
+}
+
+// @brief           - replaces contents with copies of other table's
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>& SC_HashTable<K,V,Alloc,Stats>::operator=(const SC_HashTable<K,V,Alloc,Stats>& other) {
+    if (this != &other) {
+        // copy first so this table is untouched if copying throws. The copy
+        // uses the allocator this table keeps, so its lists can be taken.
+        constexpr bool propagate =
+            std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value;
+        SC_HashTable<K,V,Alloc,Stats> copy(other, (propagate) ? other.alloc_ : this->alloc_);
+        this->template take<propagate>(copy);
+    }
+    return *this;
+}
+
+// @brief           - takes other table's lists, leaving it empty
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>::SC_HashTable(SC_HashTable<K,V,Alloc,Stats>&& other)
+    : alloc_(other.alloc_), arr_(std::move(other.arr_)),
+      max_depth_(other.max_depth_), count_(other.count_), old_(std::move(other.old_)),
+      next_(std::move(other.next_)), migrated_(other.migrated_),
+      resize_step_(other.resize_step_), stats_(other.stats_) {
+    other.clear();
+}
+
+// @brief           - takes other table's lists, leaving it empty
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>& SC_HashTable<K,V,Alloc,Stats>::operator=(SC_HashTable<K,V,Alloc,Stats>&& other) {
+    if (this == &other) return *this;
+
+    // lists were allocated by other's allocator, so only take them if
+    // this table's allocator can free them
+    constexpr bool propagate =
+        std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value;
+    if (!propagate && !(this->alloc_ == other.alloc_)) {
+        SC_HashTable<K,V,Alloc,Stats> copy(other, this->alloc_);
+        this->template take<false>(copy);
+        other.clear();
+        return *this;
+    }
+
+    this->template take<propagate>(other);
+    return *this;
+}
+
+// @brief           - frees this table's lists, then takes other's
+// @param other     - table whose lists this allocator can free
+template <typename K, typename V, typename Alloc, typename Stats>
+template <bool Adopt>
+void SC_HashTable<K,V,Alloc,Stats>::take(SC_HashTable<K,V,Alloc,Stats>& other) {
+    this->destroy_lists();
+    if constexpr (Adopt) this->alloc_ = other.alloc_;
+    this->arr_ = std::move(other.arr_);
+    this->max_depth_ = other.max_depth_;
+    this->count_ = other.count_;
+    this->old_ = std::move(other.old_);
+    this->next_ = std::move(other.next_);
+    this->migrated_ = other.migrated_;
+    this->resize_step_ = other.resize_step_;
+    this->stats_ = other.stats_;
+    other.clear();
+}
+
 // Destructor, getters, and setters.
-template <typename K, typename V>
-SC_HashTable<K,V>::~SC_HashTable() {
-    this->clear();
+template <typename K, typename V, typename Alloc, typename Stats>
+SC_HashTable<K,V,Alloc,Stats>::~SC_HashTable() {
+    this->destroy_lists();
+}
+
+// @brief           - allocates and constructs an empty list
+// @return          - pointer to new list
+template <typename K, typename V, typename Alloc, typename Stats>
+typename SC_HashTable<K,V,Alloc,Stats>::List* SC_HashTable<K,V,Alloc,Stats>::create_list() {
+    ListAlloc list_alloc(this->alloc_);
+    List* list = ListTraits::allocate(list_alloc, 1);
+    try {
+        ListTraits::construct(list_alloc, list, this->alloc_);
+    } catch (...) {
+        ListTraits::deallocate(list_alloc, list, 1);
+        throw;
+    }
+    return list;
 }
 
-template <typename K, typename V>
-std::size_t SC_HashTable<K,V>::count() {
+// @brief           - destroys and deallocates a list and its nodes
+// @param list      - pointer to list, from create_list
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::destroy_list(List* list) {
+    ListAlloc list_alloc(this->alloc_);
+    ListTraits::destroy(list_alloc, list);
+    ListTraits::deallocate(list_alloc, list, 1);
+}
+
+// @brief           - destroys every list, leaving null buckets, and
+//                    frees the old array of an unfinished resize
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::destroy_lists() {
+    for (std::size_t i = 0; i < this->arr_.length(); ++i) {
+        List* list = this->arr_.at(i);
+        if (list != nullptr) {
+            this->destroy_list(list);
+            this->arr_.at(i) = nullptr;
+        }
+    }
+
+    for (std::size_t i = 0; i < this->old_.length(); ++i) {
+        List* list = this->old_.at(i);
+        if (list != nullptr) this->destroy_list(list);
+    }
+    this->old_.clear();
+    this->migrated_ = 0;
+}
+
+// @brief           - deep copies the lists of src into dst
+// @param dst       - null buckets, as many as src has
+// @param src       - buckets to copy
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::copy_lists(Buckets& dst, Buckets& src) {
+    for (std::size_t i = 0; i < src.length(); ++i) {
+        if (src.at(i) == nullptr) continue;
+
+        List* list = this->create_list();
+        dst.set(list, i);
+        *list = *src.at(i);
+    }
+}
+
+template <typename K, typename V, typename Alloc, typename Stats>
+std::size_t SC_HashTable<K,V,Alloc,Stats>::count() {
     return this->count_;
 }
 
-template <typename K, typename V>
-std::size_t SC_HashTable<K,V>::max_depth() {
+template <typename K, typename V, typename Alloc, typename Stats>
+std::size_t SC_HashTable<K,V,Alloc,Stats>::max_depth() {
     return this->max_depth_;
 }
 
-template <typename K, typename V>
-void SC_HashTable<K,V>::set_max_depth(std::size_t depth) {
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::set_max_depth(std::size_t depth) {
     this->max_depth_ = depth;
 }
 
+template <typename K, typename V, typename Alloc, typename Stats>
+std::size_t SC_HashTable<K,V,Alloc,Stats>::resize_step() {
+    return this->resize_step_;
+}
+
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::set_resize_step(std::size_t step) {
+    // switching to one shot resizes finishes the current migration
+    if (step == 0) {
+        std::uint64_t start = this->stats_.clock();
+        this->migrate(this->old_.length());
+        this->stats_.migrated(start);
+        this->next_.clear();
+    }
+    this->resize_step_ = step;
+}
+
+template <typename K, typename V, typename Alloc, typename Stats>
+bool SC_HashTable<K,V,Alloc,Stats>::resizing() {
+    return this->old_.length() != 0;
+}
+
 // @brief           - hashes input key to index in array.
 // @param key       - immutable key to hash.
 // @return          - index linked list to add key's val to.
-template <typename K, typename V>
-std::size_t SC_HashTable<K,V>::hash(K key) {
+template <typename K, typename V, typename Alloc, typename Stats>
+std::size_t SC_HashTable<K,V,Alloc,Stats>::hash(const K& key) {
     std::size_t hash = std::hash<K>{}(key);
-    return hash % this->arr_.capacity();
+    return hash % this->arr_.length();
+}
+
+// @brief           - finds list of an unmigrated key in old_
+// @param key       - immutable key to hash.
+// @return          - list key would be in, nullptr if none
+template <typename K, typename V, typename Alloc, typename Stats>
+typename SC_HashTable<K,V,Alloc,Stats>::List* SC_HashTable<K,V,Alloc,Stats>::old_list(const K& key) {
+    // migrated buckets are null
+    if (!this->resizing()) return nullptr;
+    return this->old_.at(std::hash<K>{}(key) % this->old_.length());
 }
 
 // @brief           - add a key value pair to the hash table
 // @param key       - immutable key for new key value pair
 // @param val       - arbitrary data type value for key val pair
 // @return          - false if failed for reasons like duplicate keys
-template <typename K, typename V>
-bool SC_HashTable<K,V>::add(K key, V val) {
+template <typename K, typename V, typename Alloc, typename Stats>
+bool SC_HashTable<K,V,Alloc,Stats>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           - add a key with a value constructed from args
+// @param key       - immutable key for new key value pair
+// @param args      - arguments forwarded to V's constructor, only
+//                    used if the key isn't already stored
+// @return          - false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc, typename Stats>
+template <typename... Args>
+bool SC_HashTable<K,V,Alloc,Stats>::emplace(K key, Args&&... args) {
+    if (this->resize_step_) this->advance();
+
     // setup data
-    bool duplicates = false;
     std::size_t idx = this->hash(key);
-    KeyValue<K,V> kv = {key, val};
-    SLList<KeyValue<K,V>>* list = this->arr_.at(idx);
+    List* list = this->arr_.at(idx);
 
     // handle un-initialised list
     if (list == nullptr) {
-        list = new SLList<KeyValue<K,V>>{};
+        list = this->create_list();
         this->arr_.set(list, idx);
     }
 
     // check for duplicate keys
-    std::size_t len = list->length();
-    SLNode<KeyValue<K,V>>* par = list->head();
-    for (std::size_t i = 0; i < len; ++i) {
-        if (par && par->getData().key == key) {
-            duplicates = true;
-            break;
-        }
-        par = par->getNext();
-    }
+    bool duplicates = this->find(key) != nullptr;
 
     // otherwise, add new key-value pair
     if (!duplicates) {
-        list->push(kv);
+        list->emplace_back(KeyValue<K,V>{std::move(key), V(std::forward<Args>(args)...)});
         ++this->count_;
     }
 
@@ -148,11 +602,25 @@ bool SC_HashTable<K,V>::add(K key, V val) {
 // @brief           - remove a key value pair to the hash table
 // @param key       - immutable key to find kv pair to remove
 // @return          - false if failed for reasons like key not found
-template <typename K, typename V>
-bool SC_HashTable<K,V>::remove(K key) {
-    std::size_t idx = this->hash(key);
-    SLList<KeyValue<K,V>>* list = this->arr_.at(idx);
+template <typename K, typename V, typename Alloc, typename Stats>
+bool SC_HashTable<K,V,Alloc,Stats>::remove(const K& key) {
+    if (this->resize_step_) this->advance();
+
+    // unmigrated pairs are only in the old array
+    if (this->remove_from(this->arr_.at(this->hash(key)), key) ||
+        this->remove_from(this->old_list(key), key)) {
+        --this->count_;
+        return true;
+    }
+    return false;
+}
 
+// @brief           - removes key from a list
+// @param list      - list to search, may be nullptr
+// @param key       - key to remove
+// @return          - false if key not found
+template <typename K, typename V, typename Alloc, typename Stats>
+bool SC_HashTable<K,V,Alloc,Stats>::remove_from(List* list, const K& key) {
     if (list) {
         // check for key to remove
         std::size_t len = list->length();
@@ -160,7 +628,6 @@ bool SC_HashTable<K,V>::remove(K key) {
         for (std::size_t i = 0; i < len; ++i) {
             if (par && par->getData().key == key) {
                 list->remove_by_index(i);
-                --this->count_;
                 return true;
             }
             par = par->getNext();
@@ -174,91 +641,321 @@ bool SC_HashTable<K,V>::remove(K key) {
 // @param key       - key to retrieve value from
 // @param found     - output parameter, set to false if key not found
 // @return          - default val if key not found, else stored val
-template <typename K, typename V>
-V SC_HashTable<K,V>::at(K key, bool& found) {
-    // find relevant list
-    found = false;
-    std::size_t idx = this->hash(key);
-    SLList<KeyValue<K,V>>* list = this->arr_.at(idx);
+template <typename K, typename V, typename Alloc, typename Stats>
+V SC_HashTable<K,V,Alloc,Stats>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           - find value stored at specified key, without
+//                    copying it
+// @param key       - key to retrieve value from
+// @return          - pointer to stored val, nullptr if key not found.
+//                    Stays valid until the key is removed.
+template <typename K, typename V, typename Alloc, typename Stats>
+V* SC_HashTable<K,V,Alloc,Stats>::find(const K& key) {
+    // find relevant list, unmigrated pairs are only in the old array
+    V* val = this->find_in(this->arr_.at(this->hash(key)), key);
+    return (val || !this->resizing()) ? val : this->find_in(this->old_list(key), key);
+}
+
+// @brief           - looks up many keys at once. Walks a batch of keys
+//                    from bucket to list to first node one level at a
+//                    time, prefetching the next level for all of them,
+//                    so the cache misses overlap instead of queueing.
+// @param keys      - keys to retrieve values from
+// @param num       - number of keys
+// @param out_vals  - output parameter, num values, default val for
+//                    keys not found
+// @param out_found - output parameter, num flags, false for keys
+//                    not found
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::at_batch(const K* keys, std::size_t num, V* out_vals, bool* out_found) {
+    List** buckets = this->arr_.data();
+    std::size_t idxs[BATCH];
+    List* lists[BATCH];
+
+    for (std::size_t start = 0; start < num; start += BATCH) {
+        std::size_t len = std::min(BATCH, num - start);
+
+        // bucket pointers
+        for (std::size_t i = 0; i < len; ++i) {
+            idxs[i] = this->hash(keys[start + i]);
+            prefetch(buckets + idxs[i]);
+        }
+
+        // lists
+        for (std::size_t i = 0; i < len; ++i) {
+            lists[i] = buckets[idxs[i]];
+            if (lists[i]) prefetch(lists[i]);
+        }
+
+        // first nodes, chains are short so later nodes are left to the walk
+        for (std::size_t i = 0; i < len; ++i) {
+            SLNode<KeyValue<K,V>>* head = (lists[i]) ? lists[i]->head() : nullptr;
+            if (head) prefetch(head);
+        }
+
+        for (std::size_t i = 0; i < len; ++i) {
+            const K& key = keys[start + i];
+            V* val = this->find_in(lists[i], key);
+            if (!val && this->resizing()) val = this->find_in(this->old_list(key), key);
 
+            out_found[start + i] = val != nullptr;
+            out_vals[start + i] = (val) ? *val : V{};
+        }
+    }
+}
+
+// @brief           - adds many key value pairs, prefetching the
+//                    buckets of a batch of keys before adding any
+// @param keys      - keys of new key value pairs
+// @param vals      - values of new key value pairs
+// @param num       - number of pairs
+// @return          - number of pairs added, duplicates are skipped
+template <typename K, typename V, typename Alloc, typename Stats>
+std::size_t SC_HashTable<K,V,Alloc,Stats>::add_batch(const K* keys, const V* vals, std::size_t num) {
+    std::size_t added{0};
+
+    for (std::size_t start = 0; start < num; start += BATCH) {
+        std::size_t len = std::min(BATCH, num - start);
+
+        // additions may resize, so prefetch against the current array
+        // for each batch
+        List** buckets = this->arr_.data();
+        for (std::size_t i = 0; i < len; ++i) {
+            prefetch(buckets + this->hash(keys[start + i]));
+        }
+
+        for (std::size_t i = 0; i < len; ++i) {
+            added += this->emplace(keys[start + i], vals[start + i]);
+        }
+    }
+    return added;
+}
+
+// @brief           - finds key in a list
+// @param list      - list to search, may be nullptr
+// @param key       - key to search for
+// @return          - pointer to stored val, nullptr if not found
+template <typename K, typename V, typename Alloc, typename Stats>
+V* SC_HashTable<K,V,Alloc,Stats>::find_in(List* list, const K& key) {
     if (list) {
         // check if desired key is there
         std::size_t len = list->length();
         SLNode<KeyValue<K,V>>* par = list->head();
         for (std::size_t i = 0; i < len; ++i) {
             if (par && par->getData().key == key) {
-                found = true;
-                return par->getData().val;
+                return &par->getData().val;
             }
             par = par->getNext();
         }
     }
 
-    return V{}; // implicitly handles all exceptions
+    return nullptr; // implicitly handles unitialised list
 }
 
-// @brief           - moves els to 2x larger array to reduce collisions
-template <typename K, typename V>
-void SC_HashTable<K,V>::double_capacity() {
+// @brief           - moves els to 2x larger array to reduce collisions.
+//                    With a resize step, only starts the migration.
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::double_capacity() {
+    std::uint64_t start = this->stats_.clock();
+    if (this->resize_step_) {
+        // a resize that starts before the last finished completes it first,
+        // and fills whatever is left of the next array
+        this->migrate(this->old_.length());
+        std::size_t og_cap = this->arr_.length();
+        this->stage(og_cap * 2, og_cap * 2);
+
+        this->old_ = std::move(this->arr_);
+        this->arr_ = std::move(this->next_);
+        this->migrated_ = 0;
+        this->migrate(this->resize_step_);
+        this->stats_.resized(start);
+        return;
+    }
+
     // setup data
-    KeyValue<K,V>* old_els = new KeyValue<K,V>[this->count_];
-    std::size_t tail = 0;
-    std::size_t og_cap = this->arr_.capacity();
-    this->arr_.double_capacity();
+    DynamicArray<KeyValue<K,V>, Alloc> old_els((this->count_) ? this->count_ : 1, this->alloc_);
+    std::size_t og_cap = this->arr_.length();
+    this->arr_.resize(og_cap * 2, nullptr);
     
     // remove linked list elements
     for (std::size_t i = 0; i < og_cap; ++i) {
-        SLList<KeyValue<K,V>>* list = this->arr_.at(i);
+        List* list = this->arr_.at(i);
         std::size_t len = (list) ? list->length() : 0;
 
         for (std::size_t j = 0; j < len; ++j) {
-            *(old_els + tail) = this->arr_.at(i)->remove_by_index(0);
-            ++tail;
+            old_els.push(this->arr_.at(i)->remove_by_index(0));
         }
     }
 
     // rehash elements
     for (std::size_t i = 0; i < this->count_; ++i) {
-        KeyValue<K,V> kv = *(old_els + i);
+        KeyValue<K,V>& kv = old_els.at(i);
         std::size_t idx = this->hash(kv.key);
-        SLList<KeyValue<K,V>>* list = this->arr_.at(idx);
+        List* list = this->arr_.at(idx);
 
         if (!list) {
-            list = new SLList<KeyValue<K,V>>{};
+            list = this->create_list();
             this->arr_.set(list, idx);
         }
-        list->push(kv);
+        list->emplace_back(std::move(kv));
     }
 
-    delete[] old_els;
-    old_els = nullptr;
+    old_els.clear();
+    this->stats_.resized(start);
 }
 
-// @brief           - removes all stored data in the hashtable
-template <typename K, typename V>
-void SC_HashTable<K,V>::clear() {
-    // clear linked lists
-    for (std::size_t i = 0; i < this->arr_.capacity(); ++i) {
-        SLList<KeyValue<K,V>>* list = this->arr_.at(i);
-        if (list != nullptr) {
-            list->clear();
-            delete list;
+// @brief           - moves the pairs of the next num buckets of old_
+//                    to arr_, freeing old_ once all have moved
+// @param num       - number of old buckets
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::migrate(std::size_t num) {
+    std::size_t cap = this->old_.length();
+    std::size_t end = std::min(this->migrated_ + num, cap);
+
+    for (; this->migrated_ < end; ++this->migrated_) {
+        List* old = this->old_.at(this->migrated_);
+        if (old == nullptr) continue;
+
+        while (old->length()) {
+            KeyValue<K,V> kv = old->remove_by_index(0);
+            std::size_t idx = this->hash(kv.key);
+            List* list = this->arr_.at(idx);
+
+            if (!list) {
+                list = this->create_list();
+                this->arr_.set(list, idx);
+            }
+            list->emplace_back(std::move(kv));
         }
+        this->destroy_list(old);
+        this->old_.at(this->migrated_) = nullptr;
     }
 
-    // reset array
-    this->arr_.clear();
+    if (cap && this->migrated_ == cap) {
+        this->old_.clear();
+        this->migrated_ = 0;
+    }
+}
+
+// @brief           - fills up to fill more null buckets of next_
+// @param num       - number of buckets next_ needs
+// @param fill      - max number of buckets to fill
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::stage(std::size_t num, std::size_t fill) {
+    // reserving only maps memory, pages are touched as buckets are filled
+    if (this->next_.capacity() != num) {
+        this->next_ = Buckets(num, this->arr_.get_allocator());
+    }
+    std::size_t len = this->next_.length();
+    if (len < num) this->next_.resize(std::min(len + fill, num), nullptr);
+}
+
+// @brief           - bounded resize work done by each add or remove
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::advance() {
+    if (this->resizing()) {
+        std::uint64_t start = this->stats_.clock();
+        this->migrate(this->resize_step_);
+        this->stats_.migrated(start);
+    } else {
+        // chains usually reach max depth after about cap more adds, staging
+        // 8 buckets per update fills the 2 * cap of the next array in time
+        this->stage(this->arr_.length() * 2, 8);
+    }
+}
+
+// @brief           - get statistics policy
+// @return          - reference to recorded statistics
+template <typename K, typename V, typename Alloc, typename Stats>
+Stats& SC_HashTable<K,V,Alloc,Stats>::stats() {
+    return this->stats_;
+}
+
+// @brief           - writes one line of JSON describing the table
+// @param os        - stream to write to
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::dump_stats(std::ostream& os) {
+    // chains[i] counts buckets holding i pairs, while resizing including
+    // the unmigrated buckets of old_
+    DynamicArray<std::size_t> chains(std::size_t(16));
+    chains.push(0);
+
+    Buckets* arrs[2] = {&this->arr_, &this->old_};
+    for (Buckets* arr : arrs) {
+        std::size_t first = (arr == &this->old_) ? this->migrated_ : 0;
+        for (std::size_t i = first; i < arr->length(); ++i) {
+            List* list = arr->at(i);
+            std::size_t len = (list) ? list->length() : 0;
+            if (chains.length() <= len) chains.resize(len + 1, 0);
+            ++chains.at(len);
+        }
+    }
+
+    os << "{\"count\": " << this->count_ << ", \"capacity\": " << this->arr_.length();
+    os << ", \"load_factor\": " << float(this->count_) / float(this->arr_.length());
+    os << ", \"resizing\": " << (this->resizing() ? "true" : "false");
+    os << ", \"max_chain\": " << chains.length() - 1 << ", \"chain_lengths\": [";
+    for (std::size_t i = 0; i < chains.length(); ++i) {
+        os << ((i) ? ", " : "") << chains.at(i);
+    }
+    os << "]";
+    if constexpr (Stats::enabled) {
+        os << ", \"resizes\": " << this->stats_.resizes();
+        os << ", \"resize_ms\": " << double(this->stats_.resize_ns()) / 1e6;
+    }
+    os << "}" << std::endl;
+}
+
+// @brief           - builds a read only copy of the table over a
+//                    minimal perfect hash
+// @return          - FrozenTable holding copies of every pair
+template <typename K, typename V, typename Alloc, typename Stats>
+FrozenTable<K,V> SC_HashTable<K,V,Alloc,Stats>::freeze() {
+    return FrozenTable<K,V>(*this);
+}
+
+// @brief           - iterator to first pair, in bucket order
+template <typename K, typename V, typename Alloc, typename Stats>
+typename SC_HashTable<K,V,Alloc,Stats>::iterator SC_HashTable<K,V,Alloc,Stats>::begin() {
+    List** p_arr = this->arr_.data();
+    List** p_arr_end = p_arr + this->arr_.length();
+    if (!this->resizing()) return iterator(p_arr, p_arr_end, p_arr_end, p_arr_end);
+
+    // buckets of old_ below migrated_ are null
+    List** p_old = this->old_.data();
+    return iterator(p_arr, p_arr_end, p_old + this->migrated_, p_old + this->old_.length());
+}
+
+// @brief           - iterator past last pair
+template <typename K, typename V, typename Alloc, typename Stats>
+typename SC_HashTable<K,V,Alloc,Stats>::iterator SC_HashTable<K,V,Alloc,Stats>::end() {
+    return iterator();
+}
+
+// @brief           - removes all stored data in the hashtable
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::clear() {
+    // clear linked lists
+    this->destroy_lists();
+    this->next_.clear();
+
+    // reset array to the initial 10 null buckets so the table stays usable
+    this->arr_ = Buckets(std::size_t(10), nullptr, this->arr_.get_allocator());
     this->count_ = 0;
 }
 
 // @brief           - pretty print hashtable elements
-template <typename K, typename V>
-void SC_HashTable<K,V>::print() {
+template <typename K, typename V, typename Alloc, typename Stats>
+void SC_HashTable<K,V,Alloc,Stats>::print() {
 
-    std::size_t cap = this->arr_.capacity();
+    std::size_t cap = this->arr_.length();
     for (std::size_t i = 0; i < cap; ++i) {
         std::cout << i;
-        SLList<KeyValue<K,V>>* list = this->arr_.at(i);
+        List* list = this->arr_.at(i);
 
         if (list == nullptr || !list->length()) {
             std::cout << "| null" << std::endl;
@@ -267,6 +964,15 @@ void SC_HashTable<K,V>::print() {
             list->print(); 
         }
     }
+
+    // lists that haven't migrated yet
+    for (std::size_t i = this->migrated_; i < this->old_.length(); ++i) {
+        List* list = this->old_.at(i);
+        if (list && list->length()) {
+            std::cout << "old " << i << "| ";
+            list->print();
+        }
+    }
 }
 
 
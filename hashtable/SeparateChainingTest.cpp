@@ -5,6 +5,7 @@
 // @version      - 0.0.0
 // =============================================================================
 
+#include <memory_resource>
 #include <random>
 #include <iostream>
 #include "./SeparateChaining.hpp"
@@ -42,6 +43,97 @@ int main() {
     std::cout << my_map.remove(dist(gen)) << std::endl;
     std::cout << "Size: " << my_map.count() << std::endl;
 
+    // Test lookups by pointer, copies and moves
+    SC_HashTable<short, int> map_copy(my_map);
+    SC_HashTable<short, int> map_moved(std::move(map_copy));
+    std::cout << "Moved size: " << map_moved.count();
+    std::cout << ", source size: " << map_copy.count() << std::endl;
+    map_copy.emplace(5, 7);
+    std::cout << "Source reusable: " << *map_copy.find(5);
+    std::cout << ", missing: " << (map_copy.find(6) == nullptr) << std::endl;
+
+    // test incremental resizing, keys stay reachable mid migration
+    SC_HashTable<short, int> step_map{};
+    step_map.set_resize_step(2);
+    std::size_t resizing_ops = 0, mid_missing = 0, step_found = 0;
+    for (short i = 0; i < 1000; ++i) {
+        step_map.add(i, i);
+        if (i % 3 == 0) step_map.remove(i / 3);
+        if (step_map.resizing()) {
+            ++resizing_ops;
+            for (short j = i / 3 + 1; j <= i; ++j) mid_missing += step_map.find(j) == nullptr;
+        }
+    }
+    for (short i = 0; i < 1000; ++i) step_found += step_map.find(i) != nullptr;
+    std::cout << "Stepped resize: " << (resizing_ops > 0) << ", missing mid migration: ";
+    std::cout << mid_missing << ", size: " << step_map.count();
+    std::cout << ", found: " << step_found << std::endl;
+
+    // test batched additions and lookups, batches span several chunks
+    SC_HashTable<int, short> batch_map{};
+    int batch_keys[40]{};
+    short batch_vals[40]{};
+    bool batch_found[40]{};
+    for (int i = 0; i < 40; ++i) {
+        batch_keys[i] = (i < 35) ? i * 3 : 3;
+        batch_vals[i] = short(i);
+    }
+    std::size_t batch_added = batch_map.add_batch(batch_keys, batch_vals, 40);
+    for (int i = 0; i < 40; ++i) batch_keys[i] = i * 2;
+    batch_map.at_batch(batch_keys, 40, batch_vals, batch_found);
+    std::size_t batch_hits = 0, batch_correct = 0;
+    for (int i = 0; i < 40; ++i) {
+        batch_hits += batch_found[i];
+        batch_correct += (batch_found[i]) ? batch_vals[i] == i * 2 / 3 : batch_vals[i] == 0;
+    }
+    std::cout << "Batch added: " << batch_added << ", hits: " << batch_hits;
+    std::cout << ", correct: " << batch_correct << std::endl;
+
+    // test iteration, including entries left in the old array mid resize
+    SC_HashTable<int, int> iter_map{};
+    iter_map.set_resize_step(1);
+    std::size_t iter_resizing = 0, iter_num = 0;
+    long long iter_sum = 0;
+    for (int i = 0; i < 300; ++i) {
+        iter_map.add(i, i);
+        if (i % 5 == 0) iter_map.remove(i / 5);
+        if (iter_map.resizing()) {
+            ++iter_resizing;
+            std::size_t num = 0;
+            for (KeyValue<int, int>& kv : iter_map) num += kv.key == kv.val;
+            iter_num += num == iter_map.count();
+        }
+    }
+    for (auto it = iter_map.begin(); it != iter_map.end(); ++it) it->val *= 2;
+    for (KeyValue<int, int>& kv : iter_map) iter_sum += kv.val;
+    std::cout << "Iterated while resizing: " << (iter_resizing > 0 && iter_num == iter_resizing);
+    std::cout << ", value sum: " << iter_sum << std::endl;
+
+    // test statistics, dump_stats() scans the table, TableStats counts resizes
+    SC_HashTable<int, int> stats_map{};
+    for (int i = 0; i < 12; ++i) stats_map.add(i * 10, i);
+    stats_map.remove(20);
+    stats_map.dump_stats();
+    SC_HashTable<int, int, std::allocator<KeyValue<int, int>>, TableStats> timed_map{};
+    for (int i = 0; i < 1000; ++i) timed_map.add(i, i);
+    std::cout << "Resizes: " << timed_map.stats().resizes() << std::endl;
+
+    // test assignment between tables on different arenas, whose
+    // allocators neither propagate nor compare equal
+    std::pmr::monotonic_buffer_resource arena_a, arena_b;
+    using PmrTable = SC_HashTable<int, int, std::pmr::polymorphic_allocator<KeyValue<int, int>>>;
+    PmrTable pmr_a(&arena_a), pmr_b(&arena_b);
+    for (int i = 0; i < 100; ++i) pmr_a.add(i, i);
+    pmr_b.add(-1, -1);
+    pmr_b = pmr_a;
+    PmrTable pmr_c(&arena_a);
+    pmr_c = std::move(pmr_b);
+    PmrTable pmr_copy(pmr_c);
+    bool pmr_found = false;
+    std::cout << "Pmr assigned: " << pmr_b.count() << " " << pmr_c.count() << " " << pmr_copy.count();
+    std::cout << ", " << pmr_copy.at(42, pmr_found) << " " << pmr_found;
+    std::cout << ", " << (pmr_c.find(-1) != nullptr) << std::endl;
+
     my_map.clear();
     std::cout << "Final size: " << my_map.count() << std::endl;
 
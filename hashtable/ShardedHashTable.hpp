@@ -0,0 +1,214 @@
+// @file         ShardedHashTable.hpp
+// @brief        Defining a thread safe hashtable that stripes keys across
+//               independently locked shards of a single threaded table
+// @author       Madhav Malhotra
+// @date         2024-01-01
+// @version      0.0.0
+// @note         Lookups share a shard's lock, so the wrapped table's at()
+//               must not modify it. LP_HashTable and SC_HashTable qualify,
+//               including while they resize incrementally.
+// =============================================================================
+
+#ifndef HASHTABLE_SHARDED_HASH_TABLE_HPP
+#define HASHTABLE_SHARDED_HASH_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include "./HashPolicies.hpp"
+#include "./SeparateChaining.hpp"
+
+/*
+Declare class
+*/
+
+// Table     - single threaded table of each shard, e.g. SC_HashTable or
+//             LP_HashTable. Every shard resizes on its own.
+// ShardBits - log2 of the number of shards
+template <typename K, typename V, typename Table = SC_HashTable<K,V>, std::size_t ShardBits = 6>
+class ShardedHashTable {
+    static_assert(ShardBits > 0 && ShardBits < 16, "ShardedHashTable requires 1 to 15 shard bits");
+
+    private:
+        static constexpr std::size_t SHARDS = std::size_t{1} << ShardBits;
+
+        // own cache line each, so locking one shard doesn't slow its neighbours
+        struct alignas(64) Shard {
+            std::shared_mutex lock{};
+            Table table{};
+        };
+
+        Shard shards_[SHARDS]{};
+
+        // @brief           finds shard of a key
+        // @param key       immutable key to hash
+        // @return          shard holding key, if stored
+        Shard& shard(const K& key) {
+            // high bits of a reseeded hash. The table's own bucket choice
+            // uses the low bits of its hash (MaskReduce, ModuloReduce) or
+            // the high bits (FastRangeReduce), and would see every key of a
+            // shard share them if they were the shard bits too.
+            std::uint64_t hash = WyMix::mum(std::uint64_t(MixHash<K>{}(key)) ^ WyMix::P2, WyMix::P0);
+            return this->shards_[hash >> (64 - ShardBits)];
+        }
+
+    public:
+        // @brief           creates SHARDS empty tables
+        ShardedHashTable() = default;
+
+        // locks are shared by all threads, so the table has one owner
+        ShardedHashTable(const ShardedHashTable<K,V,Table,ShardBits>& other) = delete;
+        ShardedHashTable<K,V,Table,ShardBits>& operator=(const ShardedHashTable<K,V,Table,ShardBits>& other) = delete;
+
+        // @brief           get number of shards
+        // @return          number of independently locked tables
+        std::size_t shards();
+
+        // @brief           get count. Shards are counted one after another,
+        //                  so concurrent updates may or may not be included.
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           set resize step of every shard, see
+        //                  LP_HashTable::set_resize_step
+        // @param step      old buckets per update, 0 to rehash all at once
+        void set_resize_step(std::size_t step);
+
+        // @brief           add a key value pair to the hash table
+        // @param key       immutable key for new key value pair
+        // @param val       arbitrary data type value for key val pair
+        // @return          false if failed for reasons like duplicate keys
+        bool add(K key, V val);
+
+        // @brief           add a key with a value constructed from args
+        // @param key       immutable key for new key value pair
+        // @param args      arguments forwarded to V's constructor, only
+        //                  used if the key isn't already stored
+        // @return          false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
+        // @brief           remove a key value pair from the hash table
+        // @param key       immutable key to find kv pair to remove
+        // @return          false if failed for reasons like key not found
+        bool remove(const K& key);
+
+        // @brief           access value stored at specified key. Readers of
+        //                  a shard don't block each other.
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else copy of stored val
+        V at(const K& key, bool& found);
+
+        // @brief           calls fn on the value stored at specified key,
+        //                  while holding its shard's write lock
+        // @param key       key of value to update
+        // @param fn        callable taking V&, must not use this table
+        // @return          false if key not found
+        template <typename Fn>
+        bool visit(const K& key, Fn fn);
+
+        // @brief           deletes all elements, one shard at a time
+        void clear();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+std::size_t ShardedHashTable<K,V,Table,ShardBits>::shards() {
+    return SHARDS;
+}
+
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+std::size_t ShardedHashTable<K,V,Table,ShardBits>::count() {
+    std::size_t total{0};
+    for (Shard& s : this->shards_) {
+        std::shared_lock<std::shared_mutex> guard(s.lock);
+        total += s.table.count();
+    }
+    return total;
+}
+
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+void ShardedHashTable<K,V,Table,ShardBits>::set_resize_step(std::size_t step) {
+    for (Shard& s : this->shards_) {
+        std::unique_lock<std::shared_mutex> guard(s.lock);
+        s.table.set_resize_step(step);
+    }
+}
+
+// @brief           add a key value pair to the hash table
+// @param key       immutable key for new key value pair
+// @param val       arbitrary data type value for key val pair
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+bool ShardedHashTable<K,V,Table,ShardBits>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           add a key with a value constructed from args
+// @param key       immutable key for new key value pair
+// @param args      arguments forwarded to V's constructor, only
+//                  used if the key isn't already stored
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+template <typename... Args>
+bool ShardedHashTable<K,V,Table,ShardBits>::emplace(K key, Args&&... args) {
+    Shard& s = this->shard(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    return s.table.emplace(std::move(key), std::forward<Args>(args)...);
+}
+
+// @brief           remove a key value pair from the hash table
+// @param key       immutable key to find kv pair to remove
+// @return          false if failed for reasons like key not found
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+bool ShardedHashTable<K,V,Table,ShardBits>::remove(const K& key) {
+    Shard& s = this->shard(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    return s.table.remove(key);
+}
+
+// @brief           access value stored at specified key. Readers of
+//                  a shard don't block each other.
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else copy of stored val
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+V ShardedHashTable<K,V,Table,ShardBits>::at(const K& key, bool& found) {
+    Shard& s = this->shard(key);
+    std::shared_lock<std::shared_mutex> guard(s.lock);
+    return s.table.at(key, found);
+}
+
+// @brief           calls fn on the value stored at specified key,
+//                  while holding its shard's write lock
+// @param key       key of value to update
+// @param fn        callable taking V&, must not use this table
+// @return          false if key not found
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+template <typename Fn>
+bool ShardedHashTable<K,V,Table,ShardBits>::visit(const K& key, Fn fn) {
+    Shard& s = this->shard(key);
+    std::unique_lock<std::shared_mutex> guard(s.lock);
+    V* val = s.table.find(key);
+    if (val) fn(*val);
+    return val != nullptr;
+}
+
+// @brief           deletes all elements, one shard at a time
+template <typename K, typename V, typename Table, std::size_t ShardBits>
+void ShardedHashTable<K,V,Table,ShardBits>::clear() {
+    for (Shard& s : this->shards_) {
+        std::unique_lock<std::shared_mutex> guard(s.lock);
+        s.table.clear();
+    }
+}
+
+#endif
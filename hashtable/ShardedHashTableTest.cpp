@@ -0,0 +1,96 @@
+// @file         - ShardedHashTableTest.cpp
+// @brief        - Testing a sharded hashtable with many threads
+// @author       - Madhav Malhotra
+// @date         - 2024-01-01
+// @version      - 0.0.0
+// =============================================================================
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "./LinearProbing.hpp"
+#include "./ShardedHashTable.hpp"
+
+int main() {
+    // Test initialisation
+    ShardedHashTable<int, short> my_map{};
+    std::cout << "Shards: " << my_map.shards() << std::endl;
+
+    // Test single threaded use
+    for (int i = 0; i < 100; ++i) my_map.add(i, short(i));
+    std::cout << "Duplicate added: " << my_map.add(5, 0) << std::endl;
+    std::cout << "After addition: " << my_map.count() << std::endl;
+
+    bool found = false;
+    std::cout << my_map.at(42, found) << " " << found << std::endl;
+    my_map.visit(42, [](short& val) { val *= 2; });
+    std::cout << my_map.at(42, found) << " " << found << std::endl;
+
+    std::cout << my_map.remove(42) << " " << my_map.remove(42) << std::endl;
+    std::cout << my_map.at(42, found) << " " << found << std::endl;
+    std::cout << "After removal: " << my_map.count() << std::endl;
+
+    // many writers on disjoint keys, readers checking values never tear
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 20000;
+    ShardedHashTable<long long, long long, LP_HashTable<long long, long long>, 3> c_map{};
+    c_map.set_resize_step(8);
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&]() {
+            long long key = 0;
+            while (!done.load()) {
+                bool hit = false;
+                long long val = c_map.at(key, hit);
+                if (hit && val != key * 3) consistent = false;
+                key = (key + 7) % (THREADS * PER_THREAD);
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t) {
+        writers.emplace_back([&c_map, t]() {
+            for (long long i = t; i < THREADS * PER_THREAD; i += THREADS) {
+                c_map.add(i, i * 3);
+                // remove every 4th key again
+                if (i % 4 == 0) c_map.remove(i);
+            }
+        });
+    }
+    for (std::thread& w : writers) w.join();
+    done = true;
+    for (std::thread& r : readers) r.join();
+
+    std::size_t hits = 0;
+    for (long long i = 0; i < THREADS * PER_THREAD; ++i) {
+        bool hit = false;
+        long long val = c_map.at(i, hit);
+        hits += hit && val == i * 3 && i % 4 != 0;
+    }
+    std::cout << "Concurrent size: " << c_map.count() << ", hits: " << hits;
+    std::cout << ", consistent: " << consistent.load() << std::endl;
+
+    // shards of tables reducing with high hash bits, which the shard
+    // choice must not fix
+    using FastLP = LP_HashTable<int, int, std::allocator<KeyValue<int, int>>, MixHash<int>,
+                                LinearProbe, FastRangeReduce>;
+    ShardedHashTable<int, int, FastLP> f_map{};
+    for (int i = 0; i < 100000; ++i) f_map.add(i, i);
+    std::size_t f_hits = 0;
+    for (int i = 0; i < 200000; ++i) {
+        bool hit = false;
+        f_hits += f_map.at(i, hit) == i && hit;
+    }
+    std::cout << "FastRange shards size: " << f_map.count() << ", hits: " << f_hits << std::endl;
+
+    c_map.clear();
+    my_map.clear();
+    std::cout << "Final size: " << my_map.count() + c_map.count() << std::endl;
+
+    return 0;
+}
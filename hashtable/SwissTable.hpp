@@ -0,0 +1,548 @@
+// @file         SwissTable.hpp
+// @brief        Defining a hashtable with open addressing that probes groups
+//               of 16 buckets at once through a control byte array
+// @author       Madhav Malhotra
+// @date         2023-12-28
+// @version      0.2.0
+// @since 0.1.0  Forward iterators that skip empty groups 16 buckets at a time
+// @since 0.0.0  Tombstone heavy tables rehash in place unless nearly full
+// =============================================================================
+
+#ifndef HASHTABLE_SWISS_TABLE_HPP
+#define HASHTABLE_SWISS_TABLE_HPP
+
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "./KeyValue.hpp"
+#include "../array/DynamicArray.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+Declare class
+*/
+
+// Buckets are split into aligned groups of 16. Each bucket has a control byte:
+// empty, deleted, or the low 7 bits of its key's hash. A lookup compares a
+// whole group of control bytes against the key's 7 bits in one SSE2 compare,
+// and only reads the key value pairs whose bytes match. Groups are probed
+// quadratically, stopping at the first group that has an empty bucket.
+template <typename K, typename V, typename Alloc = std::allocator<KeyValue<K,V>>>
+class SW_HashTable {
+    protected:
+        using CtrlAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<std::int8_t>;
+
+        static constexpr std::size_t GROUP = 16;
+        static constexpr std::int8_t EMPTY = -128;
+        static constexpr std::int8_t DELETED = -2;
+
+        DynamicArray< std::int8_t, CtrlAlloc > ctrl_;
+        DynamicArray< KeyValue<K,V>, Alloc > arr_;
+        float load_threshold_{0.875};
+        std::size_t count_{};
+        std::size_t tombs_{};
+
+        // @brief           hashes and mixes input key, since std::hash is
+        //                  the identity for integers
+        // @param key       immutable key to hash.
+        // @return          mixed hash, low 7 bits go in control bytes
+        std::size_t hash(const K& key);
+
+        // @brief           bitmask of buckets in group whose control byte
+        //                  equals byte
+        // @param p_group   pointer to first control byte of group
+        // @param byte      control byte to match
+        // @return          bit i set if bucket i of group matches
+        static std::uint32_t match(const std::int8_t* p_group, std::int8_t byte);
+
+        // @brief           bitmask of empty or deleted buckets in group
+        // @param p_group   pointer to first control byte of group
+        // @return          bit i set if bucket i of group is free
+        static std::uint32_t match_free(const std::int8_t* p_group);
+
+        // @brief           finds bucket holding key
+        // @param key       key to search for
+        // @param hash      mixed hash of key
+        // @return          bucket index, number of buckets if not found
+        std::size_t locate(const K& key, std::size_t hash);
+
+        // @brief           finds first empty or deleted bucket for a hash
+        // @param hash      mixed hash of key to add
+        // @return          bucket index
+        std::size_t free_bucket(std::size_t hash);
+
+        // @brief           replaces buckets with num empty ones
+        // @param num       number of buckets, a power of 2 multiple of 16
+        void reset(std::size_t num);
+
+        // @brief           moves els into num new buckets, dropping deleted ones
+        // @param num       number of buckets, a power of 2 multiple of 16
+        void rehash(std::size_t num);
+
+    public:
+        // Forward iterator over stored pairs. Reads a group's control bytes
+        // with one SSE2 load, so runs of empty and deleted buckets are
+        // skipped 16 at a time without touching the key value pairs. Never
+        // allocates, and is invalidated by any addition or removal. Values
+        // may be updated through it, keys must not be.
+        class iterator {
+            private:
+                const std::int8_t* p_ctrl_{};
+                KeyValue<K,V>* p_arr_{};
+                std::size_t idx_{};
+                std::size_t cap_{};
+
+                // @brief       moves to the first full bucket at or after idx_
+                void skip() {
+                    while (idx_ < cap_) {
+                        std::size_t base = idx_ & ~(GROUP - 1);
+                        std::uint32_t full = ~match_free(p_ctrl_ + base) & 0xffff;
+                        full &= 0xffffu << (idx_ - base);
+                        if (full) {
+                            idx_ = base + std::size_t(__builtin_ctz(full));
+                            return;
+                        }
+                        idx_ = base + GROUP;
+                    }
+                    idx_ = cap_;
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = KeyValue<K,V>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = KeyValue<K,V>*;
+                using reference = KeyValue<K,V>&;
+
+                iterator() = default;
+
+                // @param p_ctrl    first control byte
+                // @param p_arr     first bucket
+                // @param idx       bucket to start from
+                // @param cap       number of buckets, a multiple of 16
+                iterator(const std::int8_t* p_ctrl, pointer p_arr, std::size_t idx, std::size_t cap)
+                    : p_ctrl_(p_ctrl), p_arr_(p_arr), idx_(idx), cap_(cap) {
+                    this->skip();
+                }
+
+                reference operator*() const { return p_arr_[idx_]; }
+                pointer operator->() const { return p_arr_ + idx_; }
+
+                iterator& operator++() {
+                    ++idx_;
+                    this->skip();
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator prev = *this;
+                    ++(*this);
+                    return prev;
+                }
+
+                bool operator==(const iterator& other) const { return idx_ == other.idx_; }
+                bool operator!=(const iterator& other) const { return idx_ != other.idx_; }
+        };
+
+        // @brief           creates empty hash table with 16 buckets
+        // @param alloc     allocator for bucket array
+        SW_HashTable(const Alloc& alloc = Alloc{});
+
+        // copy and move. Moved from tables are left empty with 16 buckets
+        SW_HashTable(const SW_HashTable<K,V,Alloc>& other) = default;
+        SW_HashTable<K,V,Alloc>& operator=(const SW_HashTable<K,V,Alloc>& other) = default;
+        SW_HashTable(SW_HashTable<K,V,Alloc>&& other);
+        SW_HashTable<K,V,Alloc>& operator=(SW_HashTable<K,V,Alloc>&& other);
+
+        // destructor
+        ~SW_HashTable() = default;
+
+        // @brief           get count
+        // @return          number of key value pairs in hash table
+        std::size_t count();
+
+        // @brief           get load threshold (max kv pairs / hash table capacity)
+        // @return          load threshold setting
+        float load_threshold();
+
+        // @brief           get load factor (current kv pairs / hash table capacity)
+        // @return          current load factor
+        float load_factor();
+
+        // @brief                set load factor
+        // @param load_threshold    0 < factor < 1. Recommended range: 0.7-0.875
+        void set_load_threshold(float load_threshold);
+
+        // @brief           add a key value pair to the hash table
+        // @param key       immutable key for new key value pair
+        // @param val       arbitrary data type value for key val pair
+        // @return          false if failed for reasons like duplicate keys
+        bool add(K key, V val);
+
+        // @brief           add a key with a value constructed from args
+        // @param key       immutable key for new key value pair
+        // @param args      arguments forwarded to V's constructor, only
+        //                  used if the key isn't already stored
+        // @return          false if failed for reasons like duplicate keys
+        template <typename... Args>
+        bool emplace(K key, Args&&... args);
+
+        // @brief           remove a key value pair from the hash table
+        // @param key       immutable key to find kv pair to remove
+        // @return          false if failed for reasons like key not found
+        bool remove(const K& key);
+
+        // @brief           access value stored at specified key
+        // @param key       key to retrieve value from
+        // @param found     output parameter, set to false if key not found
+        // @return          default val if key not found, else stored val
+        V at(const K& key, bool& found);
+
+        // @brief           find value stored at specified key, without
+        //                  copying it
+        // @param key       key to retrieve value from
+        // @return          pointer to stored val, nullptr if key not found.
+        //                  Invalidated by later additions.
+        V* find(const K& key);
+
+        // @brief           moves els to 2x larger array, dropping deleted buckets
+        void double_capacity();
+
+        // @brief           iterator to first pair, in bucket order
+        iterator begin();
+
+        // @brief           iterator past last pair
+        iterator end();
+
+        // @brief           deletes all elements
+        void clear();
+
+        // @brief           pretty prints saved data to console
+        void print();
+};
+
+
+/*
+Define class in hpp file due to template issues
+*/
+
+// @brief           creates empty hash table with 16 buckets
+// @param alloc     allocator for bucket array
+template <typename K, typename V, typename Alloc>
+SW_HashTable<K,V,Alloc>::SW_HashTable(const Alloc& alloc)
+    : ctrl_(GROUP, EMPTY, CtrlAlloc(alloc)), arr_(GROUP, KeyValue<K,V>{}, alloc) {}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc>
+SW_HashTable<K,V,Alloc>::SW_HashTable(SW_HashTable<K,V,Alloc>&& other)
+    : ctrl_(std::move(other.ctrl_)), arr_(std::move(other.arr_)),
+      load_threshold_(other.load_threshold_), count_(other.count_), tombs_(other.tombs_) {
+    other.clear();
+}
+
+// @brief           takes other table's buckets, leaving it empty
+template <typename K, typename V, typename Alloc>
+SW_HashTable<K,V,Alloc>& SW_HashTable<K,V,Alloc>::operator=(SW_HashTable<K,V,Alloc>&& other) {
+    if (this != &other) {
+        this->ctrl_ = std::move(other.ctrl_);
+        this->arr_ = std::move(other.arr_);
+        this->load_threshold_ = other.load_threshold_;
+        this->count_ = other.count_;
+        this->tombs_ = other.tombs_;
+        other.clear();
+    }
+    return *this;
+}
+
+// Getters and setters.
+template <typename K, typename V, typename Alloc>
+std::size_t SW_HashTable<K,V,Alloc>::count() {
+    return this->count_;
+}
+
+template <typename K, typename V, typename Alloc>
+float SW_HashTable<K,V,Alloc>::load_threshold() {
+    return this->load_threshold_;
+}
+
+template <typename K, typename V, typename Alloc>
+float SW_HashTable<K,V,Alloc>::load_factor() {
+    return float(this->count_) / float(this->arr_.length());
+}
+
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::set_load_threshold(float load_threshold) {
+    // lookups stop at groups with an empty bucket, so one must always exist
+    if (load_threshold > 0 && load_threshold < 1) {
+        this->load_threshold_ = load_threshold;
+    } else {
+        throw std::invalid_argument("Load factor is not in range (0, 1)");
+    }
+}
+
+// @brief           hashes and mixes input key, since std::hash is
+//                  the identity for integers
+// @param key       immutable key to hash.
+// @return          mixed hash, low 7 bits go in control bytes
+template <typename K, typename V, typename Alloc>
+std::size_t SW_HashTable<K,V,Alloc>::hash(const K& key) {
+    std::uint64_t hash = std::hash<K>{}(key);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return std::size_t(hash);
+}
+
+// @brief           bitmask of buckets in group whose control byte
+//                  equals byte
+// @param p_group   pointer to first control byte of group
+// @param byte      control byte to match
+// @return          bit i set if bucket i of group matches
+template <typename K, typename V, typename Alloc>
+std::uint32_t SW_HashTable<K,V,Alloc>::match(const std::int8_t* p_group, std::int8_t byte) {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_group));
+    return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(byte))));
+#else
+    std::uint32_t mask{0};
+    for (std::size_t i = 0; i < GROUP; ++i) {
+        mask |= std::uint32_t(p_group[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+// @brief           bitmask of empty or deleted buckets in group
+// @param p_group   pointer to first control byte of group
+// @return          bit i set if bucket i of group is free
+template <typename K, typename V, typename Alloc>
+std::uint32_t SW_HashTable<K,V,Alloc>::match_free(const std::int8_t* p_group) {
+    // only empty and deleted control bytes are negative
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_group));
+    return std::uint32_t(_mm_movemask_epi8(group));
+#else
+    std::uint32_t mask{0};
+    for (std::size_t i = 0; i < GROUP; ++i) {
+        mask |= std::uint32_t(p_group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+// @brief           finds bucket holding key
+// @param key       key to search for
+// @param hash      mixed hash of key
+// @return          bucket index, number of buckets if not found
+template <typename K, typename V, typename Alloc>
+std::size_t SW_HashTable<K,V,Alloc>::locate(const K& key, std::size_t hash) {
+    std::size_t cap = this->arr_.length();
+    std::size_t group_mask = cap / GROUP - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+    std::int8_t h2 = std::int8_t(hash & 0x7f);
+    const std::int8_t* p_ctrl = this->ctrl_.data();
+    KeyValue<K,V>* p_arr = this->arr_.data();
+
+    // triangular steps visit every group when the group count is a power of 2
+    for (std::size_t step = 1; step <= group_mask + 1; ++step) {
+        const std::int8_t* p_group = p_ctrl + group * GROUP;
+
+        // only touch key value pairs whose hash bits match
+        for (std::uint32_t mask = match(p_group, h2); mask; mask &= mask - 1) {
+            std::size_t idx = group * GROUP + std::size_t(__builtin_ctz(mask));
+            if (p_arr[idx].key == key) return idx;
+        }
+
+        // an empty bucket means the key was never pushed past this group
+        if (match(p_group, EMPTY)) break;
+        group = (group + step) & group_mask;
+    }
+
+    return cap;
+}
+
+// @brief           finds first empty or deleted bucket for a hash
+// @param hash      mixed hash of key to add
+// @return          bucket index
+template <typename K, typename V, typename Alloc>
+std::size_t SW_HashTable<K,V,Alloc>::free_bucket(std::size_t hash) {
+    std::size_t group_mask = this->arr_.length() / GROUP - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+
+    // load threshold < 1 guarantees a free bucket exists
+    for (std::size_t step = 1; ; ++step) {
+        std::uint32_t mask = match_free(this->ctrl_.data() + group * GROUP);
+        if (mask) return group * GROUP + std::size_t(__builtin_ctz(mask));
+        group = (group + step) & group_mask;
+    }
+}
+
+// @brief           replaces buckets with num empty ones
+// @param num       number of buckets, a power of 2 multiple of 16
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::reset(std::size_t num) {
+    this->ctrl_ = DynamicArray<std::int8_t, CtrlAlloc>(num, EMPTY, this->ctrl_.get_allocator());
+    this->arr_ = DynamicArray<KeyValue<K,V>, Alloc>(num, KeyValue<K,V>{}, this->arr_.get_allocator());
+    this->count_ = 0;
+    this->tombs_ = 0;
+}
+
+// @brief           add a key value pair to the hash table
+// @param key       immutable key for new key value pair
+// @param val       arbitrary data type value for key val pair
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc>
+bool SW_HashTable<K,V,Alloc>::add(K key, V val) {
+    return this->emplace(std::move(key), std::move(val));
+}
+
+// @brief           add a key with a value constructed from args
+// @param key       immutable key for new key value pair
+// @param args      arguments forwarded to V's constructor, only
+//                  used if the key isn't already stored
+// @return          false if failed for reasons like duplicate keys
+template <typename K, typename V, typename Alloc>
+template <typename... Args>
+bool SW_HashTable<K,V,Alloc>::emplace(K key, Args&&... args) {
+    std::size_t hash = this->hash(key);
+    if (this->locate(key, hash) < this->arr_.length()) return false;
+
+    // deleted buckets lengthen probes like full ones, so count both
+    std::size_t used = this->count_ + this->tombs_ + 1;
+    if (float(used) > this->load_threshold_ * float(this->arr_.length())) {
+        // if clearing tombstones would leave the table under 3/4 of its
+        // threshold, rehash in place so churn doesn't keep growing it
+        std::size_t cap = this->arr_.length();
+        if (float(this->count_) < this->load_threshold_ * float(cap) * 0.75f) this->rehash(cap);
+        else this->double_capacity();
+    }
+
+    std::size_t idx = this->free_bucket(hash);
+    if (this->ctrl_.at(idx) == DELETED) --this->tombs_;
+
+    KeyValue<K,V>& kv = this->arr_.at(idx);
+    kv.val = V(std::forward<Args>(args)...);
+    kv.key = std::move(key);
+    kv.notinit = false;
+    kv.tomb = false;
+    this->ctrl_.at(idx) = std::int8_t(hash & 0x7f);
+    ++this->count_;
+    return true;
+}
+
+// @brief           remove a key value pair from the hash table
+// @param key       immutable key to find kv pair to remove
+// @return          false if failed for reasons like key not found
+template <typename K, typename V, typename Alloc>
+bool SW_HashTable<K,V,Alloc>::remove(const K& key) {
+    std::size_t idx = this->locate(key, this->hash(key));
+    if (idx == this->arr_.length()) return false;
+
+    // lookups already stop at this group if it has an empty bucket, so the
+    // bucket can go back to empty. Otherwise later groups may hold keys
+    // probed past this one, so leave a tombstone.
+    const std::int8_t* p_group = this->ctrl_.data() + idx / GROUP * GROUP;
+    bool tomb = !match(p_group, EMPTY);
+    this->ctrl_.at(idx) = (tomb) ? DELETED : EMPTY;
+    this->tombs_ += tomb;
+
+    KeyValue<K,V>& kv = this->arr_.at(idx);
+    kv.key = K{};
+    kv.val = V{};
+    kv.notinit = !tomb;
+    kv.tomb = tomb;
+    --this->count_;
+    return true;
+}
+
+// @brief           access value stored at specified key
+// @param key       key to retrieve value from
+// @param found     output parameter, set to false if key not found
+// @return          default val if key not found, else stored val
+template <typename K, typename V, typename Alloc>
+V SW_HashTable<K,V,Alloc>::at(const K& key, bool& found) {
+    V* val = this->find(key);
+    found = val != nullptr;
+    return (found) ? *val : V{};
+}
+
+// @brief           find value stored at specified key, without
+//                  copying it
+// @param key       key to retrieve value from
+// @return          pointer to stored val, nullptr if key not found.
+//                  Invalidated by later additions.
+template <typename K, typename V, typename Alloc>
+V* SW_HashTable<K,V,Alloc>::find(const K& key) {
+    std::size_t idx = this->locate(key, this->hash(key));
+    return (idx < this->arr_.length()) ? &this->arr_.at(idx).val : nullptr;
+}
+
+// @brief           moves els to 2x larger array, dropping deleted buckets
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::double_capacity() {
+    this->rehash(this->arr_.length() * 2);
+}
+
+// @brief           moves els into num new buckets, dropping deleted ones
+// @param num       number of buckets, a power of 2 multiple of 16
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::rehash(std::size_t num) {
+    // take old buckets, then create new arrays
+    std::size_t cap = this->arr_.length();
+    DynamicArray<std::int8_t, CtrlAlloc> old_ctrl(std::move(this->ctrl_));
+    DynamicArray<KeyValue<K,V>, Alloc> old(std::move(this->arr_));
+    this->reset(num);
+
+    // keys are known to be unique, so place without lookups
+    for (std::size_t i = 0; i < cap; ++i) {
+        if (old_ctrl.at(i) < 0) continue;
+
+        KeyValue<K,V>& curr = old.at(i);
+        std::size_t hash = this->hash(curr.key);
+        std::size_t idx = this->free_bucket(hash);
+        this->arr_.at(idx) = std::move(curr);
+        this->ctrl_.at(idx) = std::int8_t(hash & 0x7f);
+        ++this->count_;
+    }
+}
+
+// @brief           iterator to first pair, in bucket order
+template <typename K, typename V, typename Alloc>
+typename SW_HashTable<K,V,Alloc>::iterator SW_HashTable<K,V,Alloc>::begin() {
+    return iterator(this->ctrl_.data(), this->arr_.data(), 0, this->arr_.length());
+}
+
+// @brief           iterator past last pair
+template <typename K, typename V, typename Alloc>
+typename SW_HashTable<K,V,Alloc>::iterator SW_HashTable<K,V,Alloc>::end() {
+    std::size_t cap = this->arr_.length();
+    return iterator(this->ctrl_.data(), this->arr_.data(), cap, cap);
+}
+
+// @brief           removes all stored data in the hashtable
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::clear() {
+    // restore the initial 16 empty buckets so the table stays usable
+    this->reset(GROUP);
+}
+
+// @brief           pretty print hashtable elements
+template <typename K, typename V, typename Alloc>
+void SW_HashTable<K,V,Alloc>::print() {
+    std::size_t cap = this->arr_.length();
+    for (std::size_t i = 0; i < cap; ++i) {
+        std::cout << this->arr_.at(i);
+    }
+    std::cout << std::endl;
+}
+
+
+#endif
@@ -2,13 +2,19 @@
 // @brief        - Defining a doubly linked list class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-08
-// @version      - 2.0.0
+// @version      - 2.1.0
+// @since 2.0.0  - Copy/move constructors and assignment, emplace_back/front,
+//                 destructor frees nodes
 // @since 1.0.0  - included definitions in header for template class inheritance
 // @since 0.0.0  - made memory management internal to class
 // =======================================================================================
 
 #ifndef DLList_HPP
 #define DLList_HPP
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
 #include "./DoublyLinkedNode.hpp"
 
 template <typename T>
@@ -22,6 +28,21 @@ class DLList {
         // @brief           - constructor
         DLList();
 
+        // @brief           - copies nodes of other list
+        DLList(const DLList<T>& other);
+
+        // @brief           - replaces nodes with copies of other list's
+        DLList<T>& operator=(const DLList<T>& other);
+
+        // @brief           - takes other list's nodes, leaving it empty
+        DLList(DLList<T>&& other) noexcept;
+
+        // @brief           - takes other list's nodes, leaving it empty
+        DLList<T>& operator=(DLList<T>&& other) noexcept;
+
+        // @brief           - destructor
+        ~DLList();
+
         // @brief           - prints array elements to std::cout
         void print();
 
@@ -44,6 +65,18 @@ class DLList {
         // @param val       - data in node to add
         void shift(T val);
 
+        // @brief           - constructs node data in place at end of list
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - reference to new data
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
+
+        // @brief           - constructs node data in place at start of list
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - reference to new data
+        template <typename... Args>
+        T& emplace_front(Args&&... args);
+
         // @brief           - removes node from list by index
         // @param idx       - index to remove, 0 <= idx < size_
         void remove_by_index(std::size_t idx);
@@ -64,7 +97,7 @@ class DLList {
         // @param all       - whether to remove multiple value occurrences, default false.
         // @return          - true if value(s) removed, else false
         // @note            - defined in hpp to support default argument
-        bool remove(T val, bool all = false) {
+        bool remove(const T& val, bool all = false) {
             if (this->head_ == nullptr) {
                 throw std::range_error("Cannot remove node from empty list");
             }
@@ -135,6 +168,58 @@ DLList<T>::DLList() {
     this->size_ = 0;
 }
 
+// @brief             - copies nodes of other list
+template <typename T>
+DLList<T>::DLList(const DLList<T>& other) {
+    try {
+        for (DLNode<T>* curr = other.head_; curr; curr = curr->getNext()) {
+            this->emplace_back(curr->getData());
+        }
+    } catch (...) {
+        // destructor won't run for a partially built copy
+        this->clear();
+        throw;
+    }
+}
+
+// @brief             - replaces nodes with copies of other list's
+template <typename T>
+DLList<T>& DLList<T>::operator=(const DLList<T>& other) {
+    if (this != &other) {
+        // copy first so this list is untouched if copying throws
+        DLList<T> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// @brief             - takes other list's nodes, leaving it empty
+template <typename T>
+DLList<T>::DLList(DLList<T>&& other) noexcept
+    : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+}
+
+// @brief             - takes other list's nodes, leaving it empty
+template <typename T>
+DLList<T>& DLList<T>::operator=(DLList<T>&& other) noexcept {
+    if (this != &other) {
+        this->clear();
+        std::swap(this->head_, other.head_);
+        std::swap(this->tail_, other.tail_);
+        std::swap(this->size_, other.size_);
+    }
+    return *this;
+}
+
+// @brief             - destructor
+template <typename T>
+DLList<T>::~DLList() {
+    this->clear();
+}
+
 // @brief             - prints array values to std::cout
 template <typename T>
 void DLList<T>::print() {
@@ -169,7 +254,23 @@ DLNode <T>* DLList<T>::tail() {
 // @param val        - data in node to add
 template <typename T>
 void DLList<T>::push(T val) {
-    DLNode<T>* node = new DLNode<T>(val);
+    this->emplace_back(std::move(val));
+}
+
+// @brief           - inserts element at start of list
+// @param val       - value of new node
+template <typename T>
+void DLList<T>::shift(T val) {
+    this->emplace_front(std::move(val));
+}
+
+// @brief            - constructs node data in place at end of list
+// @param args       - arguments forwarded to T's constructor
+// @return           - reference to new data
+template <typename T>
+template <typename... Args>
+T& DLList<T>::emplace_back(Args&&... args) {
+    DLNode<T>* node = new DLNode<T>(std::in_place, std::forward<Args>(args)...);
 
     // Only init head if list is empty
     if (this->head_ == nullptr) {
@@ -181,13 +282,16 @@ void DLList<T>::push(T val) {
 
     this->tail_ = node;
     ++this->size_;
+    return node->getData();
 }
 
-// @brief           - inserts element at start of list
-// @param val       - value of new node
+// @brief            - constructs node data in place at start of list
+// @param args       - arguments forwarded to T's constructor
+// @return           - reference to new data
 template <typename T>
-void DLList<T>::shift(T val) {
-    DLNode<T>* node = new DLNode<T>(val);
+template <typename... Args>
+T& DLList<T>::emplace_front(Args&&... args) {
+    DLNode<T>* node = new DLNode<T>(std::in_place, std::forward<Args>(args)...);
 
     // Only init tail if list is empty
     if (this->size_ == 0) {
@@ -199,6 +303,7 @@ void DLList<T>::shift(T val) {
 
     this->head_ = node;
     ++this->size_;
+    return node->getData();
 }
 
 // @brief           - removes node from list
@@ -220,6 +325,12 @@ void DLList<T>::remove_by_index(std::size_t idx) {
         throw std::invalid_argument("Index beyond array length");
     }
 
+    // special case, only node, no neighbours to relink
+    if (this->size_ == 1) {
+        this->clear();
+        return;
+    }
+
     // pointers to track to avoid bugs
     DLNode<T>* curr = this->head_->getNext();
     DLNode<T>* removed = nullptr;
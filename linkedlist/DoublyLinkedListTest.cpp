@@ -52,6 +52,16 @@ int main() {
     dll_test.pop();
     std::cout << ". Updated size: " << dll_test.length() << std::endl;
 
+    // Test copy, move and emplace
+    DLList<char> dll_copy(dll_test);
+    dll_copy.emplace_back('x');
+    dll_copy.emplace_front('w');
+    std::cout << "Copy with emplaced ends: ";
+    dll_copy.print();
+    DLList<char> dll_moved(std::move(dll_copy));
+    std::cout << "Moved size: " << dll_moved.length();
+    std::cout << ", source size: " << dll_copy.length() << std::endl;
+
     std::cout << "Cleared remaining " << dll_test.length() << " nodes." << std::endl;
     dll_test.clear();
 }
\ No newline at end of file
@@ -2,13 +2,16 @@
 // @brief        - Declaring a doubly linked node class for a doubly linked list
 // @author       - Madhav Malhotra
 // @date         - 2023-12-08
-// @version      - 0.0.0
+// @version      - 0.1.0
+// @since 0.0.0  - Data moved in, returned by reference, or built in place
 // =======================================================================================
 
 
 #ifndef DLNode_HPP
 #define DLNode_HPP
 
+#include <utility>
+
 /*
 Declare Node class members
 */
@@ -25,16 +28,20 @@ class DLNode {
         DLNode<T>* setNext(DLNode<T>* next);
         DLNode<T>* setLast(DLNode<T>* last);
 
-        T getData();
+        T& getData();
         DLNode<T>* getNext();
         DLNode<T>* getLast();
 
         // Cannot define externally while keeping default template type
-        DLNode(T data = T{}) {
-            this->data_ = data;
+        DLNode(T data = T{}) : data_(std::move(data)) {
             this->next_ = nullptr;
             this->last_ = nullptr;
         }
+
+        // @brief           - constructs data in place from args
+        // @param args      - arguments forwarded to T's constructor
+        template <typename... Args>
+        explicit DLNode(std::in_place_t, Args&&... args) : data_(std::forward<Args>(args)...) {}
 };
 
 
@@ -46,7 +53,7 @@ Define Node class members
 // @param T data    - new value
 template <typename T>
 void DLNode<T>::setData(T data) {
-    this->data_ = data;
+    this->data_ = std::move(data);
 }
 
 // @brief            - updates next node
@@ -69,9 +76,9 @@ DLNode<T>* DLNode<T>::setLast(DLNode<T>* last) {
     return prev; // CLASS USERS HANDLE MEMORY DEALLOCATION
 }
 
-// @brief            - get node data
+// @brief            - get node data, by reference to avoid copies
 template <typename T>
-T DLNode<T>::getData() {
+T& DLNode<T>::getData() {
     return this->data_;
 }
 
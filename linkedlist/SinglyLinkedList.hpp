@@ -2,7 +2,9 @@
 // @brief        - Defining a singly linked list class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-08
-// @version      - 2.1.0
+// @version      - 2.3.0
+// @since 2.2.0  - Copy/move constructors and assignment, emplace_back/front
+// @since 2.1.0  - Allocator template parameter for node memory
 // @since 2.0.0  - Updated remove_by_index to return node val (to support queue)
 // @since 1.1.0  - Shifted class definitions to hpp due to template class problems
 // @since 1.0.0  - Added shift/print functions
@@ -11,22 +13,55 @@
 
 #ifndef SLList_HPP
 #define SLList_HPP
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 #include "./SinglyLinkedNode.hpp"
 
 /* 
 Declare class members
 */
 
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class SLList {
     private:
+        using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<SLNode<T>>;
+        using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+        NodeAlloc alloc_{};
         SLNode<T>* head_{};
         SLNode<T>* tail_{};
         std::size_t size_{};
+
+        // @brief           - allocates and constructs a new node
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - pointer to new node
+        template <typename... Args>
+        SLNode<T>* create_node(Args&&... args);
+
+        // @brief           - destroys and deallocates a node
+        // @param node      - pointer to node, from create_node
+        void destroy_node(SLNode<T>* node);
     
     public:
         // @brief           - constructor
-        SLList();
+        // @param alloc     - allocator that provides node memory
+        SLList(const Alloc& alloc = Alloc{});
+
+        // @brief           - copies nodes of other list
+        SLList(const SLList<T,Alloc>& other);
+
+        // @brief           - replaces nodes with copies of other list's
+        SLList<T,Alloc>& operator=(const SLList<T,Alloc>& other);
+
+        // @brief           - takes other list's nodes, leaving it empty
+        SLList(SLList<T,Alloc>&& other) noexcept;
+
+        // @brief           - takes other list's nodes, leaving it empty.
+        //                    Moves values one by one if allocators differ.
+        SLList<T,Alloc>& operator=(SLList<T,Alloc>&& other);
 
         // @brief           - destructor
         virtual ~SLList();
@@ -53,6 +88,18 @@ class SLList {
         // @param val       - value of new node
         virtual void shift(T val);
 
+        // @brief           - constructs node value in place at end of list
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - reference to new value
+        template <typename... Args>
+        T& emplace_back(Args&&... args);
+
+        // @brief           - constructs node value in place at start of list
+        // @param args      - arguments forwarded to T's constructor
+        // @return          - reference to new value
+        template <typename... Args>
+        T& emplace_front(Args&&... args);
+
         // @brief           - returns node at some index
         // @param idx       - 0 <= idx < size_
         // @return          - node at input index
@@ -74,23 +121,29 @@ class SLList {
         // @param all       - whether to remove multiple value occurrences, default false.
         // @return          - true if value(s) removed, else false
         // @note            - defined within class to support default argument
-        bool remove(T val, bool all = false) {
+        bool remove(const T& val, bool all = false) {
             if (this->head_ == nullptr) {
                 throw std::range_error("Cannot remove node from empty list");
             }
 
-            // special case: remove head
+            // special case: remove head, possibly several in a row
             bool removed = false;
-            if (this->head_->getData() == val) {
+            while (this->head_ && (!removed || all) && this->head_->getData() == val) {
                 SLNode<T>* temp = this->head_;
                 this->head_ = this->head_->getNext();
                 
-                delete temp;
+                this->destroy_node(temp);
                 temp = nullptr;
                 removed = true;
                 --this->size_;
             }
 
+            // avoid dangling tail pointer if list emptied
+            if (this->head_ == nullptr) {
+                this->tail_ = nullptr;
+                return removed;
+            }
+
             // normal case
             SLNode<T>* curr = this->head_->getNext();
             SLNode<T>* prev = this->head_;
@@ -105,7 +158,7 @@ class SLList {
                     }
 
                     // cleanup
-                    delete curr;
+                    this->destroy_node(curr);
                     curr = nullptr;
                     removed = true;
                     --this->size_;
@@ -136,41 +189,134 @@ Define Singly Linked List Class
 */
 
 // @brief           - constructor
-template <typename T>
-SLList<T>::SLList() {
+// @param alloc     - allocator that provides node memory
+template <typename T, typename Alloc>
+SLList<T,Alloc>::SLList(const Alloc& alloc) : alloc_(alloc) {
     this->head_ = nullptr;
     this->tail_ = nullptr;
     this->size_ = 0;
 }
 
+// @brief           - copies nodes of other list
+template <typename T, typename Alloc>
+SLList<T,Alloc>::SLList(const SLList<T,Alloc>& other)
+    : alloc_(NodeTraits::select_on_container_copy_construction(other.alloc_)) {
+    try {
+        for (SLNode<T>* curr = other.head_; curr; curr = curr->getNext()) {
+            this->emplace_back(curr->getData());
+        }
+    } catch (...) {
+        // destructor won't run for a partially built copy
+        this->clear();
+        throw;
+    }
+}
+
+// @brief           - replaces nodes with copies of other list's
+template <typename T, typename Alloc>
+SLList<T,Alloc>& SLList<T,Alloc>::operator=(const SLList<T,Alloc>& other) {
+    if (this != &other) {
+        // copy first so this list is untouched if copying throws
+        constexpr bool propagate = NodeTraits::propagate_on_container_copy_assignment::value;
+        SLList<T,Alloc> copy((propagate) ? Alloc(other.alloc_) : Alloc(this->alloc_));
+        for (SLNode<T>* curr = other.head_; curr; curr = curr->getNext()) {
+            copy.emplace_back(curr->getData());
+        }
+
+        this->clear();
+        if constexpr (propagate) std::swap(this->alloc_, copy.alloc_);
+        std::swap(this->head_, copy.head_);
+        std::swap(this->tail_, copy.tail_);
+        std::swap(this->size_, copy.size_);
+    }
+    return *this;
+}
+
+// @brief           - takes other list's nodes, leaving it empty
+template <typename T, typename Alloc>
+SLList<T,Alloc>::SLList(SLList<T,Alloc>&& other) noexcept
+    : alloc_(std::move(other.alloc_)), head_(other.head_), tail_(other.tail_), size_(other.size_) {
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+}
+
+// @brief           - takes other list's nodes, leaving it empty.
+//                    Moves values one by one if allocators differ.
+template <typename T, typename Alloc>
+SLList<T,Alloc>& SLList<T,Alloc>::operator=(SLList<T,Alloc>&& other) {
+    if (this == &other) return *this;
+
+    constexpr bool propagate = NodeTraits::propagate_on_container_move_assignment::value;
+    this->clear();
+
+    // nodes can only change hands if this allocator can free them
+    if (propagate || NodeTraits::is_always_equal::value || this->alloc_ == other.alloc_) {
+        if constexpr (propagate) this->alloc_ = std::move(other.alloc_);
+        std::swap(this->head_, other.head_);
+        std::swap(this->tail_, other.tail_);
+        std::swap(this->size_, other.size_);
+    } else {
+        for (SLNode<T>* curr = other.head_; curr; curr = curr->getNext()) {
+            this->emplace_back(std::move(curr->getData()));
+        }
+        other.clear();
+    }
+    return *this;
+}
+
 // @brief           - destructor
-template <typename T>
-SLList<T>::~SLList() {
-    SLList<T>::clear();
+template <typename T, typename Alloc>
+SLList<T,Alloc>::~SLList() {
+    SLList<T,Alloc>::clear();
+}
+
+// @brief           - allocates and constructs a new node
+// @param args      - arguments forwarded to T's constructor
+// @return          - pointer to new node
+template <typename T, typename Alloc>
+template <typename... Args>
+SLNode<T>* SLList<T,Alloc>::create_node(Args&&... args) {
+    SLNode<T>* node = NodeTraits::allocate(this->alloc_, 1);
+    try {
+        NodeTraits::construct(this->alloc_, node, std::in_place, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(this->alloc_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+// @brief           - destroys and deallocates a node
+// @param node      - pointer to node, from create_node
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::destroy_node(SLNode<T>* node) {
+    NodeTraits::destroy(this->alloc_, node);
+    NodeTraits::deallocate(this->alloc_, node, 1);
 }
 
 
 // @brief            - returns number of nodes
-template <typename T>
-std::size_t SLList<T>::length() {
+template <typename T, typename Alloc>
+std::size_t SLList<T,Alloc>::length() {
     return this->size_;
 }
 
 // @brief            - returns first node
-template <typename T>
-SLNode<T>* SLList<T>::head() {
+template <typename T, typename Alloc>
+SLNode<T>* SLList<T,Alloc>::head() {
     return this->head_;
 }
 
 // @brief            - returns last node
-template <typename T>
-SLNode<T>* SLList<T>::tail() {
+template <typename T, typename Alloc>
+SLNode<T>* SLList<T,Alloc>::tail() {
     return this->tail_;
 } 
 
 // @brief            - prints nodes to cout
-template <typename T>
-void SLList<T>::print() {
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::print() {
     SLNode<T>* curr = this->head_;
     for (std::size_t i = 0; i < this->size_; ++i) {
         std::cout << curr->getData() << " ";
@@ -184,9 +330,25 @@ void SLList<T>::print() {
 
 // @brief           - adds node to end of list
 // @param val       - value of new node
-template <typename T>
-void SLList<T>::push(T val) {
-    SLNode<T>* node = new SLNode<T>(val);
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::push(T val) {
+    this->emplace_back(std::move(val));
+}
+
+// @brief           - adds node to start of list
+// @param val       - value of new node
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::shift(T val) {
+    this->emplace_front(std::move(val));
+}
+
+// @brief           - constructs node value in place at end of list
+// @param args      - arguments forwarded to T's constructor
+// @return          - reference to new value
+template <typename T, typename Alloc>
+template <typename... Args>
+T& SLList<T,Alloc>::emplace_back(Args&&... args) {
+    SLNode<T>* node = this->create_node(std::forward<Args>(args)...);
 
     // Only init head if list is empty
     if (this->head_ == nullptr) {
@@ -197,13 +359,16 @@ void SLList<T>::push(T val) {
 
     this->tail_ = node;
     ++this->size_;
+    return node->getData();
 }
 
-// @brief           - adds node to start of list
-// @param val       - value of new node
-template <typename T>
-void SLList<T>::shift(T val) {
-    SLNode<T>* node = new SLNode<T>(val);
+// @brief           - constructs node value in place at start of list
+// @param args      - arguments forwarded to T's constructor
+// @return          - reference to new value
+template <typename T, typename Alloc>
+template <typename... Args>
+T& SLList<T,Alloc>::emplace_front(Args&&... args) {
+    SLNode<T>* node = this->create_node(std::forward<Args>(args)...);
 
     // Only init tail if list is empty
     if (this->head_ == nullptr) {
@@ -214,6 +379,7 @@ void SLList<T>::shift(T val) {
     this->head_ = node;
 
     ++this->size_;
+    return node->getData();
 }
 
 // @brief           - removes node from list
@@ -229,8 +395,8 @@ Intentionally blank
 // @brief          - removes node from list by index
 // @param idx      - index to remove, 0 <= idx < size_
 // @return         - value of node removed
-template <typename T>
-T SLList<T>::remove_by_index(std::size_t idx) {
+template <typename T, typename Alloc>
+T SLList<T,Alloc>::remove_by_index(std::size_t idx) {
     // implicitly handles empty list
     if (idx >= this->size_) {
         throw std::invalid_argument("Index beyond array length");
@@ -262,8 +428,8 @@ T SLList<T>::remove_by_index(std::size_t idx) {
     }
 
     // Clean up
-    T val = removed->getData();
-    delete removed;
+    T val = std::move(removed->getData());
+    this->destroy_node(removed);
     removed = curr = prev = nullptr;
 
     --this->size_;
@@ -271,8 +437,8 @@ T SLList<T>::remove_by_index(std::size_t idx) {
 }
 
 // @brief            - returns node at specified index
-template <typename T>
-SLNode<T>* SLList<T>::at(std::size_t idx) {
+template <typename T, typename Alloc>
+SLNode<T>* SLList<T,Alloc>::at(std::size_t idx) {
     // implicitly handles empty list
     if (idx >= this->size_) {
         throw std::invalid_argument("Index beyond array length");
@@ -291,8 +457,8 @@ SLNode<T>* SLList<T>::at(std::size_t idx) {
 }
 
 // @brief            - helper wrapper on top of remove_by_index
-template <typename T>
-void SLList<T>::pop() {
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::pop() {
     // explicitly handles empty list
     if (this->size_ == 0) {
         throw std::range_error("Cannot pop from empty list");
@@ -302,8 +468,8 @@ void SLList<T>::pop() {
 }
 
 // @brief            - clears all nodes in linked list
-template <typename T>
-void SLList<T>::clear() {
+template <typename T, typename Alloc>
+void SLList<T,Alloc>::clear() {
     SLNode<T>* curr = this->head_;
     SLNode<T>* removing = nullptr;
 
@@ -311,7 +477,7 @@ void SLList<T>::clear() {
     for (std::size_t i = 0; i < this->size_; ++i) {
         removing = curr;
         curr = curr->getNext();
-        delete removing;
+        this->destroy_node(removing);
     }
 
     // cleanup
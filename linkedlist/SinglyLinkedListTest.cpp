@@ -56,6 +56,16 @@ int main() {
     sll_test.pop();
     std::cout << ". Updated size: " << sll_test.length() << std::endl;
 
+    // Test copy, move and emplace
+    SLList<char> sll_copy(sll_test);
+    sll_copy.emplace_back('x');
+    sll_copy.emplace_front('w');
+    std::cout << "Copy with emplaced ends: ";
+    sll_copy.print();
+    SLList<char> sll_moved(std::move(sll_copy));
+    std::cout << "Moved size: " << sll_moved.length();
+    std::cout << ", source size: " << sll_copy.length() << std::endl;
+
     std::cout << "Cleared remaining " << sll_test.length() << " nodes." << std::endl;
     sll_test.clear();
 }
\ No newline at end of file
@@ -2,12 +2,15 @@
 // @brief        - Declaring a singly linked node class for a singly linked list.
 // @author       - Madhav Malhotra
 // @date         - 2023-12-08
-// @version      - 0.0.0
+// @version      - 0.1.0
+// @since 0.0.0  - Data moved in, returned by reference, or built in place
 // =======================================================================================
 
 #ifndef SLNode_HPP
 #define SLNode_HPP
 
+#include <utility>
+
 /*
 Declare Node class members
 */
@@ -21,14 +24,18 @@ class SLNode {
     public:
         void setData(T data);
         SLNode<T>* setNext(SLNode<T>* next);
-        T getData();
+        T& getData();
         SLNode<T>* getNext();
 
         // Cannot define externally while keeping default template type
-        SLNode(T data = T{}) {
-            this->data_ = data;
+        SLNode(T data = T{}) : data_(std::move(data)) {
             this->next_ = nullptr;
         }
+
+        // @brief           - constructs data in place from args
+        // @param args      - arguments forwarded to T's constructor
+        template <typename... Args>
+        explicit SLNode(std::in_place_t, Args&&... args) : data_(std::forward<Args>(args)...) {}
 };
 
 
@@ -40,7 +47,7 @@ Define Node class members
 // @param T data    - new value
 template <typename T>
 void SLNode<T>::setData(T data) {
-    this->data_ = data;
+    this->data_ = std::move(data);
 }
 
 // @brief            - updates next node
@@ -53,9 +60,9 @@ SLNode<T>* SLNode<T>::setNext(SLNode<T>* next) {
     return prev; // CLASS USERS HANDLE MEMORY DEALLOCATION
 }
 
-// @brief            - get node data
+// @brief            - get node data, by reference to avoid copies
 template <typename T>
-T SLNode<T>::getData() {
+T& SLNode<T>::getData() {
     return this->data_;
 }
 
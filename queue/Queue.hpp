@@ -2,12 +2,14 @@
 // @brief        - Defining a queue class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-11
-// @version      - 1.0.0
+// @version      - 1.1.0
+// @since 1.0.0  - Enqueued values moved into list
 // @since 0.0.0  - Patched bug where polling from queue didn't return data
 // =======================================================================================
 
-#ifndef STACK_HPP
-#define STACK_HPP
+#ifndef QUEUE_HPP
+#define QUEUE_HPP
+#include <utility>
 #include "../linkedlist/SinglyLinkedList.hpp"
 
 template <typename T>
@@ -23,7 +25,7 @@ class Queue : public SLList<T> {
         // @param val       - the value of the node to add
         // @note            - defined in hpp since short
         void enqueue(T val) {
-            SLList<T>::push(val);
+            SLList<T>::push(std::move(val));
         }
 
         // @brief           - removes a node from the front of the queue
@@ -2,11 +2,13 @@
 // @brief        - Defining a stack class
 // @author       - Madhav Malhotra
 // @date         - 2023-12-09
-// @version      - 0.0.0
+// @version      - 0.1.0
+// @since 0.0.0  - Pushed values moved into list
 // =======================================================================================
 
 #ifndef STACK_HPP
 #define STACK_HPP
+#include <utility>
 #include "../linkedlist/SinglyLinkedList.hpp"
 
 template <typename T>
@@ -22,7 +24,7 @@ class Stack : public SLList<T> {
         // @param val       - the value of the node to add
         // @note            - defined in hpp since short
         void push(T val) {
-            SLList<T>::shift(val);
+            SLList<T>::shift(std::move(val));
         }
 
         // @brief           - removes a node from the top of the stack